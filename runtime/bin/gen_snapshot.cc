@@ -451,8 +451,11 @@ static void MaybeLoadCode() {
     CHECK_RESULT(result);
   }
 
+  // For AOT snapshots only the usage counts of the training run are used, to
+  // order the generated code.
   if ((load_type_feedback_filename != NULL) &&
-      ((snapshot_kind == kCoreJIT) || (snapshot_kind == kAppJIT))) {
+      ((snapshot_kind == kCoreJIT) || (snapshot_kind == kAppJIT) ||
+       IsSnapshottingForPrecompilation())) {
     uint8_t* buffer = NULL;
     intptr_t size = 0;
     ReadFile(load_type_feedback_filename, &buffer, &size);
@@ -0,0 +1,724 @@
+// Copyright (c) 2019, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/bootstrap_natives.h"
+
+#include "vm/exceptions.h"
+#include "vm/native_entry.h"
+#include "vm/object.h"
+
+namespace dart {
+
+// Subquadratic multiplication, division and decimal conversion for the digit
+// arrays of _BigIntImpl. The Dart code and its intrinsics handle small
+// operands; these natives are called above its size thresholds.
+
+// Digits are 32-bit and stored least significant first, as in the digit
+// arrays of _BigIntImpl.
+typedef uint32_t digit_t;
+typedef uint64_t ddigit_t;
+static const int kDigitBits = 32;
+
+// Below these sizes in digits, the quadratic algorithms are faster.
+static const intptr_t kKaratsubaThreshold = 32;
+static const intptr_t kBurnikelZieglerThreshold = 48;
+static const intptr_t kRadixConversionThreshold = 32;
+
+static const digit_t kTenToTheNine = 1000000000;
+static const intptr_t kDecimalDigitsPerTenToTheNine = 9;
+
+// Returns the number of digits of x[0..n) without its leading zeros.
+static intptr_t Trim(const digit_t* x, intptr_t n) {
+  while (n > 0 && x[n - 1] == 0) {
+    n--;
+  }
+  return n;
+}
+
+// Scratch digits for the recursive algorithms below. A native allocates one
+// buffer for its whole computation. Each recursion level takes its
+// temporaries from the top and gives them back on return, so the memory used
+// is bounded by the deepest path instead of growing with the recursion tree.
+class DigitScratch : public ValueObject {
+ public:
+  DigitScratch(Zone* zone, intptr_t capacity)
+      : zone_(zone),
+        digits_(zone->Alloc<digit_t>(capacity)),
+        capacity_(capacity),
+        used_(0) {}
+
+  digit_t* Alloc(intptr_t length) {
+    if (length > capacity_ - used_) {
+      // Not reached with the capacities computed below.
+      return zone_->Alloc<digit_t>(length);
+    }
+    digit_t* result = digits_ + used_;
+    used_ += length;
+    return result;
+  }
+
+ private:
+  friend class DigitScratchScope;
+
+  Zone* zone_;
+  digit_t* digits_;
+  intptr_t capacity_;
+  intptr_t used_;
+
+  DISALLOW_COPY_AND_ASSIGN(DigitScratch);
+};
+
+// Gives back the scratch digits allocated during its lifetime.
+class DigitScratchScope : public ValueObject {
+ public:
+  explicit DigitScratchScope(DigitScratch* scratch)
+      : scratch_(scratch), used_(scratch->used_) {}
+  ~DigitScratchScope() { scratch_->used_ = used_; }
+
+ private:
+  DigitScratch* scratch_;
+  intptr_t used_;
+
+  DISALLOW_COPY_AND_ASSIGN(DigitScratchScope);
+};
+
+static int Compare(const digit_t* x,
+                   intptr_t n,
+                   const digit_t* y,
+                   intptr_t m) {
+  n = Trim(x, n);
+  m = Trim(y, m);
+  if (n != m) {
+    return n < m ? -1 : 1;
+  }
+  while (--n >= 0) {
+    if (x[n] != y[n]) {
+      return x[n] < y[n] ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+// r[0..n) = x[0..n) + y[0..m) with m <= n. Returns the carry out.
+static digit_t Add(const digit_t* x,
+                   intptr_t n,
+                   const digit_t* y,
+                   intptr_t m,
+                   digit_t* r) {
+  ASSERT(m <= n);
+  ddigit_t carry = 0;
+  for (intptr_t i = 0; i < m; i++) {
+    carry += static_cast<ddigit_t>(x[i]) + y[i];
+    r[i] = static_cast<digit_t>(carry);
+    carry >>= kDigitBits;
+  }
+  for (intptr_t i = m; i < n; i++) {
+    carry += x[i];
+    r[i] = static_cast<digit_t>(carry);
+    carry >>= kDigitBits;
+  }
+  return static_cast<digit_t>(carry);
+}
+
+// x[0..n) += y[0..m) with m <= n. Returns the carry out.
+static digit_t AddTo(digit_t* x, intptr_t n, const digit_t* y, intptr_t m) {
+  ASSERT(m <= n);
+  ddigit_t carry = 0;
+  intptr_t i = 0;
+  for (; i < m; i++) {
+    carry += static_cast<ddigit_t>(x[i]) + y[i];
+    x[i] = static_cast<digit_t>(carry);
+    carry >>= kDigitBits;
+  }
+  for (; carry != 0 && i < n; i++) {
+    carry += x[i];
+    x[i] = static_cast<digit_t>(carry);
+    carry >>= kDigitBits;
+  }
+  return static_cast<digit_t>(carry);
+}
+
+// x[0..n) -= y[0..m) with m <= n. Returns the borrow out.
+static digit_t SubtractFrom(digit_t* x,
+                            intptr_t n,
+                            const digit_t* y,
+                            intptr_t m) {
+  ASSERT(m <= n);
+  digit_t borrow = 0;
+  intptr_t i = 0;
+  for (; i < m; i++) {
+    const ddigit_t difference =
+        static_cast<ddigit_t>(x[i]) - y[i] - borrow;
+    x[i] = static_cast<digit_t>(difference);
+    borrow = static_cast<digit_t>(difference >> kDigitBits) & 1;
+  }
+  for (; borrow != 0 && i < n; i++) {
+    borrow = (x[i] == 0) ? 1 : 0;
+    x[i]--;
+  }
+  return borrow;
+}
+
+// r[0..n+m) = x[0..n) * y[0..m).
+static void MultiplySchoolbook(const digit_t* x,
+                               intptr_t n,
+                               const digit_t* y,
+                               intptr_t m,
+                               digit_t* r) {
+  memset(r, 0, (n + m) * sizeof(digit_t));
+  for (intptr_t i = 0; i < m; i++) {
+    const ddigit_t y_digit = y[i];
+    if (y_digit == 0) {
+      continue;
+    }
+    ddigit_t carry = 0;
+    for (intptr_t j = 0; j < n; j++) {
+      carry += x[j] * y_digit + r[i + j];
+      r[i + j] = static_cast<digit_t>(carry);
+      carry >>= kDigitBits;
+    }
+    r[i + n] = static_cast<digit_t>(carry);
+  }
+}
+
+// The number of scratch digits Multiply needs for factors of at most n
+// digits.
+static intptr_t MultiplyScratchLength(intptr_t n) {
+  intptr_t length = 0;
+  while (n >= kKaratsubaThreshold) {
+    const intptr_t h = (n + 1) / 2;
+    length += 4 * h + 4;
+    n = h + 1;
+  }
+  return length;
+}
+
+// r[0..n+m) = x[0..n) * y[0..m), with Karatsuba's algorithm above
+// kKaratsubaThreshold digits.
+static void Multiply(DigitScratch* scratch,
+                     const digit_t* x,
+                     intptr_t n,
+                     const digit_t* y,
+                     intptr_t m,
+                     digit_t* r) {
+  if (n < m) {
+    Multiply(scratch, y, m, x, n, r);
+    return;
+  }
+  if (m < kKaratsubaThreshold) {
+    MultiplySchoolbook(x, n, y, m, r);
+    return;
+  }
+  DigitScratchScope scope(scratch);
+  const intptr_t h = (n + 1) / 2;
+  if (m <= h) {
+    // Too unbalanced to split both factors at the same digit: multiply y by
+    // slices of x of its own length instead.
+    memset(r, 0, (n + m) * sizeof(digit_t));
+    digit_t* product = scratch->Alloc(2 * m);
+    for (intptr_t i = 0; i < n; i += m) {
+      const intptr_t slice = (n - i < m) ? n - i : m;
+      Multiply(scratch, x + i, slice, y, m, product);
+      const digit_t carry = AddTo(r + i, n + m - i, product, slice + m);
+      ASSERT(carry == 0);
+    }
+    return;
+  }
+  // With x = x1 * B^h + x0 and y = y1 * B^h + y0:
+  // x * y = x1 * y1 * B^2h + ((x0 + x1) * (y0 + y1) - x0 * y0 - x1 * y1) * B^h
+  //       + x0 * y0.
+  Multiply(scratch, x, h, y, h, r);
+  Multiply(scratch, x + h, n - h, y + h, m - h, r + 2 * h);
+  digit_t* x_sum = scratch->Alloc(h + 1);
+  x_sum[h] = Add(x, h, x + h, n - h, x_sum);
+  digit_t* y_sum = scratch->Alloc(h + 1);
+  y_sum[h] = Add(y, h, y + h, m - h, y_sum);
+  const intptr_t middle_length = 2 * h + 2;
+  digit_t* middle = scratch->Alloc(middle_length);
+  Multiply(scratch, x_sum, h + 1, y_sum, h + 1, middle);
+  SubtractFrom(middle, middle_length, r, 2 * h);
+  SubtractFrom(middle, middle_length, r + 2 * h, n + m - 2 * h);
+  const digit_t carry =
+      AddTo(r + h, n + m - h, middle, Trim(middle, middle_length));
+  ASSERT(carry == 0);
+}
+
+// Subtracts q * b[0..n) from a[0..n]. Returns true if the result is negative.
+static bool SubtractProduct(digit_t* a,
+                            const digit_t* b,
+                            intptr_t n,
+                            ddigit_t q) {
+  ddigit_t carry = 0;
+  digit_t borrow = 0;
+  for (intptr_t i = 0; i < n; i++) {
+    const ddigit_t product = q * b[i] + carry;
+    carry = product >> kDigitBits;
+    const ddigit_t difference = static_cast<ddigit_t>(a[i]) -
+                                static_cast<digit_t>(product) - borrow;
+    a[i] = static_cast<digit_t>(difference);
+    borrow = static_cast<digit_t>(difference >> kDigitBits) & 1;
+  }
+  const ddigit_t difference = static_cast<ddigit_t>(a[n]) - carry - borrow;
+  a[n] = static_cast<digit_t>(difference);
+  return (difference >> kDigitBits) != 0;
+}
+
+static void Decrement(digit_t* x, intptr_t n) {
+  for (intptr_t i = 0; i < n; i++) {
+    if (x[i]-- != 0) {
+      return;
+    }
+  }
+  UNREACHABLE();
+}
+
+// Divides a[0..n+m) by the normalized b[0..n), whose top digit has its most
+// significant bit set. Stores the quotient in q[0..m] and leaves the
+// remainder in a[0..n), clearing a[n..n+m). This is Knuth's algorithm D.
+static void DivideSchoolbook(digit_t* a,
+                             intptr_t m,
+                             const digit_t* b,
+                             intptr_t n,
+                             digit_t* q) {
+  ASSERT((b[n - 1] >> (kDigitBits - 1)) == 1);
+  if (Compare(a + m, n, b, n) >= 0) {
+    SubtractFrom(a + m, n, b, n);
+    q[m] = 1;
+  } else {
+    q[m] = 0;
+  }
+  const ddigit_t kBase = static_cast<ddigit_t>(1) << kDigitBits;
+  const ddigit_t top = b[n - 1];
+  const ddigit_t second = (n >= 2) ? b[n - 2] : 0;
+  for (intptr_t j = m - 1; j >= 0; j--) {
+    const ddigit_t numerator =
+        (static_cast<ddigit_t>(a[j + n]) << kDigitBits) | a[j + n - 1];
+    ddigit_t estimate = numerator / top;
+    ddigit_t remainder = numerator % top;
+    const ddigit_t next = (n >= 2) ? a[j + n - 2] : 0;
+    while (estimate >= kBase ||
+           estimate * second > ((remainder << kDigitBits) | next)) {
+      estimate--;
+      remainder += top;
+      if (remainder >= kBase) {
+        break;
+      }
+    }
+    if (SubtractProduct(a + j, b, n, estimate)) {
+      estimate--;
+      AddTo(a + j, n + 1, b, n);
+      a[j + n] = 0;
+    }
+    q[j] = static_cast<digit_t>(estimate);
+  }
+}
+
+// The number of scratch digits DivideRecursive needs for quotients of m
+// digits.
+static intptr_t DivideRecursiveScratchLength(intptr_t m) {
+  if (m < kBurnikelZieglerThreshold) {
+    return 0;
+  }
+  const intptr_t k = m / 2;
+  return (m + 1 + k) + (k + 1) +
+         Utils::Maximum(DivideRecursiveScratchLength(m - k),
+                        MultiplyScratchLength(m - k + 1));
+}
+
+// Divides a[0..n+m) by the normalized b[0..n) with m <= n, using the
+// recursive algorithm of Burnikel and Ziegler. Same contract as
+// DivideSchoolbook.
+static void DivideRecursive(DigitScratch* scratch,
+                            digit_t* a,
+                            intptr_t m,
+                            const digit_t* b,
+                            intptr_t n,
+                            digit_t* q) {
+  ASSERT(m <= n);
+  if (m < kBurnikelZieglerThreshold) {
+    DivideSchoolbook(a, m, b, n, q);
+    return;
+  }
+  DigitScratchScope scope(scratch);
+  // With b = b1 * B^k + b0, divide the top half of a by b1 and correct the
+  // remainder by the quotient times b0, then do the same for the bottom half.
+  const intptr_t k = m / 2;
+  const digit_t* b1 = b + k;
+  const intptr_t width = n + m - k;
+  digit_t* product = scratch->Alloc(m + 1 + k);
+
+  DivideRecursive(scratch, a + 2 * k, m - k, b1, n - k, q + k);
+  Multiply(scratch, q + k, m - k + 1, b, k, product);
+  if (SubtractFrom(a + k, width, product, Trim(product, m + 1))) {
+    do {
+      Decrement(q + k, m - k + 1);
+    } while (AddTo(a + k, width, b, n) == 0);
+  }
+
+  digit_t* low_quotient = scratch->Alloc(k + 1);
+  DivideRecursive(scratch, a + k, k, b1, n - k, low_quotient);
+  memmove(q, low_quotient, k * sizeof(digit_t));
+  AddTo(q + k, m - k + 1, low_quotient + k, 1);
+  Multiply(scratch, low_quotient, k + 1, b, k, product);
+  if (SubtractFrom(a, n + m, product, Trim(product, 2 * k + 1))) {
+    do {
+      Decrement(q, m + 1);
+    } while (AddTo(a, n + m, b, n) == 0);
+  }
+}
+
+// Shifts x[0..n) left by shift < kDigitBits bits into r[0..n]. r may be x.
+static void ShiftLeft(const digit_t* x, intptr_t n, int shift, digit_t* r) {
+  digit_t carry = 0;
+  for (intptr_t i = 0; i < n; i++) {
+    const digit_t digit = x[i];
+    r[i] = (shift == 0) ? digit : (digit << shift) | carry;
+    carry = (shift == 0) ? 0 : digit >> (kDigitBits - shift);
+  }
+  r[n] = carry;
+}
+
+// Shifts x[0..n) right by shift < kDigitBits bits in place.
+static void ShiftRight(digit_t* x, intptr_t n, int shift) {
+  if (shift == 0) {
+    return;
+  }
+  for (intptr_t i = 0; i < n; i++) {
+    x[i] = (x[i] >> shift) |
+           ((i + 1 < n) ? x[i + 1] << (kDigitBits - shift) : 0);
+  }
+}
+
+// The number of scratch digits Divide needs for a divisor of m digits and a
+// dividend of n digits.
+static intptr_t DivideScratchLength(intptr_t n, intptr_t m) {
+  return (m + 1) + (n + 1) + (m + 1) + DivideRecursiveScratchLength(m);
+}
+
+// Computes q[0..n-m] = x[0..n) / y[0..m) and r[0..m) = x[0..n) % y[0..m),
+// with n >= m and y[m - 1] != 0.
+static void Divide(DigitScratch* scratch,
+                   const digit_t* x,
+                   intptr_t n,
+                   const digit_t* y,
+                   intptr_t m,
+                   digit_t* q,
+                   digit_t* r) {
+  ASSERT(n >= m && m > 0 && y[m - 1] != 0);
+  DigitScratchScope scope(scratch);
+  const int shift = Utils::CountLeadingZeros32(y[m - 1]);
+  digit_t* b = scratch->Alloc(m + 1);
+  ShiftLeft(y, m, shift, b);
+  ASSERT(b[m] == 0);
+  digit_t* a = scratch->Alloc(n + 1);
+  ShiftLeft(x, n, shift, a);
+
+  // Produce the quotient in blocks of at most m digits, from the top. Each
+  // block divides the remainder so far followed by the next digits of a, so
+  // its quotient fits in the block.
+  const intptr_t quotient_length = n + 1 - m;
+  digit_t* block = scratch->Alloc(m + 1);
+  for (intptr_t j = quotient_length; j > 0;) {
+    const intptr_t size = (j < m) ? j : m;
+    j -= size;
+    DivideRecursive(scratch, a + j, size, b, m, block);
+    ASSERT(block[size] == 0);
+    memmove(q + j, block, size * sizeof(digit_t));
+  }
+  ShiftRight(a, m, shift);
+  memmove(r, a, m * sizeof(digit_t));
+}
+
+// Powers of ten used to split numbers for radix conversion:
+// powers[i] = 10^(9 * 2^i).
+class DecimalPowers : public ValueObject {
+ public:
+  explicit DecimalPowers(Zone* zone) : zone_(zone), count_(0) {}
+
+  // Adds powers until the largest one has at least [length] digits.
+  void EnsureLength(intptr_t length) {
+    DigitScratch scratch(zone_, MultiplyScratchLength(length));
+    if (count_ == 0) {
+      digits_[0] = zone_->Alloc<digit_t>(1);
+      digits_[0][0] = kTenToTheNine;
+      lengths_[0] = 1;
+      count_ = 1;
+    }
+    while (lengths_[count_ - 1] < length) {
+      ASSERT(count_ < kMaxPowers);
+      const digit_t* last = digits_[count_ - 1];
+      const intptr_t last_length = lengths_[count_ - 1];
+      digit_t* square = zone_->Alloc<digit_t>(2 * last_length);
+      Multiply(&scratch, last, last_length, last, last_length, square);
+      digits_[count_] = square;
+      lengths_[count_] = Trim(square, 2 * last_length);
+      count_++;
+    }
+  }
+
+  intptr_t count() const { return count_; }
+  const digit_t* digits(intptr_t i) const { return digits_[i]; }
+  intptr_t length(intptr_t i) const { return lengths_[i]; }
+
+ private:
+  static const intptr_t kMaxPowers = 40;
+
+  Zone* zone_;
+  intptr_t count_;
+  digit_t* digits_[kMaxPowers];
+  intptr_t lengths_[kMaxPowers];
+};
+
+// The number of scratch digits ToDecimal needs for n digits at [level].
+static intptr_t ToDecimalScratchLength(const DecimalPowers& powers,
+                                       intptr_t n,
+                                       intptr_t level) {
+  intptr_t length = 0;
+  for (; level >= 0 && n >= kRadixConversionThreshold; level--) {
+    const intptr_t power_length = powers.length(level);
+    if (n >= power_length) {
+      length += (n + 1) + DivideScratchLength(n, power_length);
+      n = Utils::Maximum(n - power_length + 1, power_length);
+    }
+  }
+  return length;
+}
+
+// Writes x[0..n) < 10^(9 * 2^(level + 1)) as exactly 9 * 2^(level + 1)
+// decimal digits, with leading zeros, into out. Clobbers x.
+static void ToDecimal(DigitScratch* scratch,
+                      const DecimalPowers& powers,
+                      digit_t* x,
+                      intptr_t n,
+                      intptr_t level,
+                      char* out) {
+  const intptr_t width = kDecimalDigitsPerTenToTheNine << (level + 1);
+  n = Trim(x, n);
+  if (level < 0 || n < kRadixConversionThreshold) {
+    char* position = out + width;
+    while (n > 0) {
+      // x, remainder = x ~/ 10^9, x % 10^9.
+      ddigit_t remainder = 0;
+      for (intptr_t i = n - 1; i >= 0; i--) {
+        const ddigit_t current = (remainder << kDigitBits) | x[i];
+        x[i] = static_cast<digit_t>(current / kTenToTheNine);
+        remainder = current % kTenToTheNine;
+      }
+      n = Trim(x, n);
+      for (intptr_t i = 0; i < kDecimalDigitsPerTenToTheNine; i++) {
+        *--position = '0' + (remainder % 10);
+        remainder /= 10;
+      }
+    }
+    while (position > out) {
+      *--position = '0';
+    }
+    return;
+  }
+  const intptr_t half = width / 2;
+  const intptr_t power_length = powers.length(level);
+  if (n < power_length) {
+    memset(out, '0', half);
+    ToDecimal(scratch, powers, x, n, level - 1, out + half);
+    return;
+  }
+  DigitScratchScope scope(scratch);
+  digit_t* quotient = scratch->Alloc(n - power_length + 1);
+  digit_t* remainder = scratch->Alloc(power_length);
+  Divide(scratch, x, n, powers.digits(level), power_length, quotient,
+         remainder);
+  ToDecimal(scratch, powers, quotient, n - power_length + 1, level - 1, out);
+  ToDecimal(scratch, powers, remainder, power_length, level - 1, out + half);
+}
+
+// Converts the decimal digits chars[0..length) to r[0..*r_length), allocated
+// in zone.
+static digit_t* FromDecimal(Zone* zone,
+                            DigitScratch* scratch,
+                            const DecimalPowers& powers,
+                            const char* chars,
+                            intptr_t length,
+                            intptr_t* r_length) {
+  intptr_t level = powers.count() - 1;
+  while (level >= 0 &&
+         (kDecimalDigitsPerTenToTheNine << level) >= length) {
+    level--;
+  }
+  if (level < 0 ||
+      length < kRadixConversionThreshold * kDecimalDigitsPerTenToTheNine) {
+    // r = r * 10^9 + the next nine digits.
+    digit_t* r =
+        zone->Alloc<digit_t>(length / kDecimalDigitsPerTenToTheNine + 1);
+    intptr_t n = 0;
+    intptr_t i = 0;
+    intptr_t chunk = length % kDecimalDigitsPerTenToTheNine;
+    if (chunk == 0) {
+      chunk = kDecimalDigitsPerTenToTheNine;
+    }
+    while (i < length) {
+      ddigit_t carry = 0;
+      for (intptr_t end = i + chunk; i < end; i++) {
+        carry = carry * 10 + (chars[i] - '0');
+      }
+      chunk = kDecimalDigitsPerTenToTheNine;
+      for (intptr_t j = 0; j < n; j++) {
+        carry += static_cast<ddigit_t>(r[j]) * kTenToTheNine;
+        r[j] = static_cast<digit_t>(carry);
+        carry >>= kDigitBits;
+      }
+      if (carry != 0) {
+        r[n++] = static_cast<digit_t>(carry);
+      }
+    }
+    *r_length = n;
+    return r;
+  }
+  // high * 10^(9 * 2^level) + low.
+  const intptr_t low_length = kDecimalDigitsPerTenToTheNine << level;
+  intptr_t high_n, low_n;
+  const digit_t* high =
+      FromDecimal(zone, scratch, powers, chars, length - low_length, &high_n);
+  const digit_t* low = FromDecimal(zone, scratch, powers,
+                                   chars + length - low_length, low_length,
+                                   &low_n);
+  const intptr_t power_length = powers.length(level);
+  const intptr_t n = high_n + power_length + 1;
+  digit_t* r = zone->Alloc<digit_t>(n);
+  if (high_n == 0) {
+    memset(r, 0, n * sizeof(digit_t));
+  } else {
+    Multiply(scratch, high, high_n, powers.digits(level), power_length, r);
+    r[n - 1] = 0;
+  }
+  const digit_t carry = AddTo(r, n, low, low_n);
+  ASSERT(carry == 0);
+  *r_length = Trim(r, n);
+  return r;
+}
+
+// Copies digits[0..used) out of the heap.
+static digit_t* CopyDigits(Zone* zone, const TypedData& digits, intptr_t used) {
+  if (used < 0 || used > digits.Length()) {
+    Exceptions::ThrowRangeError("used", Integer::Handle(Integer::New(used)), 0,
+                                digits.Length());
+  }
+  digit_t* copy = zone->Alloc<digit_t>(used);
+  NoSafepointScope no_safepoint;
+  memmove(copy, digits.DataAddr(0), used * sizeof(digit_t));
+  return copy;
+}
+
+static void StoreDigits(const TypedData& digits,
+                        intptr_t offset,
+                        const digit_t* source,
+                        intptr_t length) {
+  if (offset + length > digits.Length()) {
+    Exceptions::ThrowRangeError(
+        "digits", Integer::Handle(Integer::New(offset + length)), 0,
+        digits.Length());
+  }
+  NoSafepointScope no_safepoint;
+  memmove(reinterpret_cast<digit_t*>(digits.DataAddr(0)) + offset, source,
+          length * sizeof(digit_t));
+}
+
+// resultDigits[0..xUsed+yUsed) = xDigits[0..xUsed) * yDigits[0..yUsed).
+// Returns xUsed + yUsed.
+DEFINE_NATIVE_ENTRY(Bigint_mulDigits, 0, 5) {
+  GET_NON_NULL_NATIVE_ARGUMENT(TypedData, x_digits, arguments->NativeArgAt(0));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, x_used, arguments->NativeArgAt(1));
+  GET_NON_NULL_NATIVE_ARGUMENT(TypedData, y_digits, arguments->NativeArgAt(2));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, y_used, arguments->NativeArgAt(3));
+  GET_NON_NULL_NATIVE_ARGUMENT(TypedData, result_digits,
+                               arguments->NativeArgAt(4));
+  const intptr_t n = x_used.Value();
+  const intptr_t m = y_used.Value();
+  const digit_t* x = CopyDigits(zone, x_digits, n);
+  const digit_t* y = CopyDigits(zone, y_digits, m);
+  digit_t* result = zone->Alloc<digit_t>(n + m);
+  DigitScratch scratch(zone, MultiplyScratchLength(Utils::Maximum(n, m)));
+  Multiply(&scratch, x, n, y, m, result);
+  StoreDigits(result_digits, 0, result, n + m);
+  return Smi::New(n + m);
+}
+
+// Divides xDigits[0..xUsed) by yDigits[0..yUsed), where xUsed >= yUsed and
+// the top digit of y is not zero. Stores the remainder in
+// resultDigits[0..yUsed) and the quotient in resultDigits[yUsed..xUsed+1),
+// the layout _BigIntImpl._divRem caches.
+DEFINE_NATIVE_ENTRY(Bigint_divRemDigits, 0, 5) {
+  GET_NON_NULL_NATIVE_ARGUMENT(TypedData, x_digits, arguments->NativeArgAt(0));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, x_used, arguments->NativeArgAt(1));
+  GET_NON_NULL_NATIVE_ARGUMENT(TypedData, y_digits, arguments->NativeArgAt(2));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, y_used, arguments->NativeArgAt(3));
+  GET_NON_NULL_NATIVE_ARGUMENT(TypedData, result_digits,
+                               arguments->NativeArgAt(4));
+  const intptr_t n = x_used.Value();
+  const intptr_t m = y_used.Value();
+  const digit_t* x = CopyDigits(zone, x_digits, n);
+  const digit_t* y = CopyDigits(zone, y_digits, m);
+  if (m == 0 || n < m || y[m - 1] == 0) {
+    Exceptions::ThrowArgumentError(y_digits);
+  }
+  digit_t* quotient = zone->Alloc<digit_t>(n - m + 1);
+  digit_t* remainder = zone->Alloc<digit_t>(m);
+  DigitScratch scratch(zone, DivideScratchLength(n, m));
+  Divide(&scratch, x, n, y, m, quotient, remainder);
+  StoreDigits(result_digits, 0, remainder, m);
+  StoreDigits(result_digits, m, quotient, n - m + 1);
+  return Object::null();
+}
+
+// Returns the decimal digits of the positive digits[0..used).
+DEFINE_NATIVE_ENTRY(Bigint_toDecimalString, 0, 2) {
+  GET_NON_NULL_NATIVE_ARGUMENT(TypedData, digits, arguments->NativeArgAt(0));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, used, arguments->NativeArgAt(1));
+  const intptr_t n = used.Value();
+  digit_t* x = CopyDigits(zone, digits, n);
+  // Split at the power of ten whose square exceeds x. x < 2^(32 * n) and a
+  // power with m digits is at least 2^(32 * (m - 1)), so its square exceeds x
+  // once 2 * (m - 1) >= n, rounding up for odd n.
+  DecimalPowers powers(zone);
+  powers.EnsureLength((n + 1) / 2 + 1);
+  const intptr_t level = powers.count() - 1;
+  const intptr_t width = kDecimalDigitsPerTenToTheNine << (level + 1);
+  char* chars = zone->Alloc<char>(width);
+  DigitScratch scratch(zone, ToDecimalScratchLength(powers, n, level));
+  ToDecimal(&scratch, powers, x, n, level, chars);
+  intptr_t start = 0;
+  while (start < width - 1 && chars[start] == '0') {
+    start++;
+  }
+  return String::FromLatin1(reinterpret_cast<const uint8_t*>(chars + start),
+                            width - start);
+}
+
+// Returns the digits of the value of the decimal digits in [source].
+DEFINE_NATIVE_ENTRY(Bigint_parseDecimal, 0, 1) {
+  GET_NON_NULL_NATIVE_ARGUMENT(String, source, arguments->NativeArgAt(0));
+  const intptr_t length = source.Length();
+  char* chars = zone->Alloc<char>(length);
+  for (intptr_t i = 0; i < length; i++) {
+    const int32_t c = source.CharAt(i);
+    if (!Utils::IsDecimalDigit(c)) {
+      Exceptions::ThrowArgumentError(source);
+    }
+    chars[i] = static_cast<char>(c);
+  }
+  // Split at about half the length of the value.
+  DecimalPowers powers(zone);
+  powers.EnsureLength(length / 19 + 1);
+  // Every nine decimal digits need at most one digit, so no factor is longer.
+  DigitScratch scratch(zone, MultiplyScratchLength(
+                                 length / kDecimalDigitsPerTenToTheNine + 1));
+  intptr_t n;
+  const digit_t* r = FromDecimal(zone, &scratch, powers, chars, length, &n);
+  // Digit arrays have even length, see _newDigits.
+  const TypedData& result = TypedData::Handle(
+      zone, TypedData::New(kTypedDataUint32ArrayCid, n + (n & 1)));
+  StoreDigits(result, 0, r, n);
+  return result.raw();
+}
+
+}  // namespace dart
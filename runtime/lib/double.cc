@@ -14,6 +14,7 @@
 #include "vm/object.h"
 #include "vm/runtime_entry.h"  // DartModulo.
 #include "vm/symbols.h"
+#include "vm/zone_text_buffer.h"
 
 namespace dart {
 
@@ -214,6 +215,80 @@ DEFINE_NATIVE_ENTRY(Double_toString, 0, 1) {
   return number.ToString(Heap::kNew);
 }
 
+// Formats a whole Float64List, joined by [separator], without allocating a
+// string per element.
+DEFINE_NATIVE_ENTRY(Double_formatAll, 0, 2) {
+  GET_NON_NULL_NATIVE_ARGUMENT(TypedDataBase, list, arguments->NativeArgAt(0));
+  GET_NON_NULL_NATIVE_ARGUMENT(String, separator, arguments->NativeArgAt(1));
+  ASSERT(list.ElementType() == kFloat64ArrayElement);
+  const char* separator_chars = separator.ToCString();
+  const intptr_t length = list.Length();
+  const intptr_t kBufferSize = 128;
+  char buffer[kBufferSize];
+  ZoneTextBuffer result(zone, length * 8 + 1);
+  {
+    NoSafepointScope no_safepoint;
+    const double* data = reinterpret_cast<const double*>(list.DataAddr(0));
+    for (intptr_t i = 0; i < length; i++) {
+      if (i > 0) {
+        result.AddString(separator_chars);
+      }
+      const double value = data[i];
+      if (isnan(value)) {
+        result.AddString("NaN");
+      } else if (isinf(value)) {
+        result.AddString(value < 0 ? "-Infinity" : "Infinity");
+      } else {
+        DoubleToCString(value, buffer, kBufferSize);
+        result.AddString(buffer);
+      }
+    }
+  }
+  return String::New(result.buffer());
+}
+
+// Parses the strings in [sources] from [start] on into [result]. Returns the
+// index of the first element that is not a plain double literal, which the
+// caller handles with double.parse.
+DEFINE_NATIVE_ENTRY(Double_parseAll, 0, 3) {
+  GET_NON_NULL_NATIVE_ARGUMENT(Instance, sources, arguments->NativeArgAt(0));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, start, arguments->NativeArgAt(1));
+  GET_NON_NULL_NATIVE_ARGUMENT(TypedDataBase, result,
+                               arguments->NativeArgAt(2));
+  ASSERT(result.ElementType() == kFloat64ArrayElement);
+  Array& elements = Array::Handle(zone);
+  intptr_t length;
+  if (sources.IsArray()) {
+    elements = Array::Cast(sources).raw();
+    length = elements.Length();
+  } else if (sources.IsGrowableObjectArray()) {
+    elements = GrowableObjectArray::Cast(sources).data();
+    length = GrowableObjectArray::Cast(sources).Length();
+  } else {
+    return start.raw();
+  }
+  if (length > result.Length()) {
+    length = result.Length();
+  }
+  String& source = String::Handle(zone);
+  Object& element = Object::Handle(zone);
+  intptr_t i = start.Value();
+  for (; i < length; i++) {
+    element = elements.At(i);
+    if (!element.IsString()) {
+      break;
+    }
+    source ^= element.raw();
+    double value;
+    if ((source.Length() == 0) ||
+        !String::ParseDouble(source, 0, source.Length(), &value)) {
+      break;
+    }
+    reinterpret_cast<double*>(result.DataAddr(0))[i] = value;
+  }
+  return Smi::New(i);
+}
+
 DEFINE_NATIVE_ENTRY(Double_toStringAsFixed, 0, 2) {
   // The boundaries are exclusive.
   static const double kLowerBoundary = -1e21;
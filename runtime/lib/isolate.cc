@@ -15,6 +15,7 @@
 #include "vm/dart_api_message.h"
 #include "vm/dart_entry.h"
 #include "vm/exceptions.h"
+#include "vm/flags.h"
 #include "vm/lockers.h"
 #include "vm/longjump.h"
 #include "vm/message_handler.h"
@@ -28,6 +29,14 @@
 
 namespace dart {
 
+DEFINE_FLAG(int,
+            isolate_spawn_pool_size,
+            0,
+            "Number of initialized isolates to keep ready in every isolate "
+            "group that spawns isolates with Isolate.spawn, so that spawning "
+            "does not have to create and initialize a new isolate. Only used "
+            "with --enable-isolate-groups.");
+
 DEFINE_NATIVE_ENTRY(CapabilityImpl_factory, 0, 1) {
   ASSERT(
       TypeArguments::CheckedHandle(zone, arguments->NativeArgAt(0)).IsNull());
@@ -114,6 +123,77 @@ static void ThrowIsolateSpawnException(const String& message) {
   Exceptions::ThrowByType(Exceptions::kIsolateSpawn, args);
 }
 
+// Creates and initializes a new isolate within [group] and exits it again.
+static Isolate* CreateInitializedIsolate(IsolateGroup* group,
+                                         const char* name,
+                                         char** error) {
+  Dart_InitializeIsolateCallback initialize_callback =
+      Isolate::InitializeCallback();
+  ASSERT(initialize_callback != nullptr);
+
+  Isolate* isolate = CreateWithinExistingIsolateGroup(group, name, error);
+  if (isolate == nullptr) {
+    return nullptr;
+  }
+
+  void* child_isolate_data = nullptr;
+  bool success = initialize_callback(&child_isolate_data, error);
+  isolate->set_init_callback_data(child_isolate_data);
+  if (!success) {
+    Dart_ShutdownIsolate();
+    return nullptr;
+  }
+  Dart_ExitIsolate();
+  return isolate;
+}
+
+// Tops up the spawn pool of [group] to --isolate_spawn_pool_size isolates.
+//
+// The caller has to keep an isolate of [group] alive while this runs.
+static void RefillPrespawnedIsolates(IsolateGroup* group) {
+  while (group->PrespawnedIsolateCount() < FLAG_isolate_spawn_pool_size) {
+    char* error = nullptr;
+    Isolate* isolate = CreateInitializedIsolate(group, "prespawned", &error);
+    if (isolate == nullptr) {
+      // Failures will be reported by regular spawns.
+      free(error);
+      return;
+    }
+    if (!group->AddPrespawnedIsolate(isolate, FLAG_isolate_spawn_pool_size)) {
+      Dart_EnterIsolate(Api::CastIsolate(isolate));
+      Dart_ShutdownIsolate();
+      return;
+    }
+  }
+}
+
+// Refills the spawn pool of an isolate group off the spawning thread, so that
+// the spawn which emptied the pool does not wait for the refill.
+class RefillPrespawnedIsolatesTask : public ThreadPool::Task {
+ public:
+  explicit RefillPrespawnedIsolatesTask(Isolate* parent_isolate)
+      : parent_isolate_(parent_isolate) {
+    // Keep the parent, and thereby the isolate group, alive until the pool
+    // has been refilled.
+    parent_isolate->IncrementSpawnCount();
+  }
+
+  ~RefillPrespawnedIsolatesTask() override {
+    parent_isolate_->DecrementSpawnCount();
+  }
+
+  void Run() override {
+    IsolateGroup* group = parent_isolate_->group();
+    RefillPrespawnedIsolates(group);
+    group->FinishPrespawnedIsolatesRefill();
+  }
+
+ private:
+  Isolate* parent_isolate_;
+
+  DISALLOW_COPY_AND_ASSIGN(RefillPrespawnedIsolatesTask);
+};
+
 class SpawnIsolateTask : public ThreadPool::Task {
  public:
   SpawnIsolateTask(Isolate* parent_isolate,
@@ -167,7 +247,17 @@ class SpawnIsolateTask : public ThreadPool::Task {
         return;
       }
 
-      isolate = CreateWithinExistingIsolateGroup(group, name, &error);
+      isolate = group->TakePrespawnedIsolate();
+      if (isolate != nullptr) {
+        isolate->set_name(name);
+      } else {
+        isolate = CreateInitializedIsolate(group, name, &error);
+      }
+      if (isolate != nullptr &&
+          group->StartPrespawnedIsolatesRefill(FLAG_isolate_spawn_pool_size)) {
+        Dart::thread_pool()->Run<RefillPrespawnedIsolatesTask>(
+            parent_isolate_);
+      }
       parent_isolate_->DecrementSpawnCount();
       parent_isolate_ = nullptr;
       if (isolate == nullptr) {
@@ -175,17 +265,6 @@ class SpawnIsolateTask : public ThreadPool::Task {
         free(error);
         return;
       }
-
-      void* child_isolate_data = nullptr;
-      bool success = initialize_callback(&child_isolate_data, &error);
-      isolate->set_init_callback_data(child_isolate_data);
-      if (!success) {
-        Dart_ShutdownIsolate();
-        FailedSpawn(error);
-        free(error);
-        return;
-      }
-      Dart_ExitIsolate();
     }
 
     if (isolate == nullptr) {
@@ -481,6 +560,10 @@ static intptr_t GetTypedDataSizeOrThrow(const Instance& instance) {
   Exceptions::ThrowArgumentError(instance);
 }
 
+// Number of bytes copied into a [TransferableTypedData] between safepoint
+// checks.
+static const intptr_t kTransferCopyChunkSize = 1 * MB;
+
 DEFINE_NATIVE_ENTRY(TransferableTypedData_factory, 0, 2) {
   ASSERT(
       TypeArguments::CheckedHandle(zone, arguments->NativeArgAt(0)).IsNull());
@@ -529,16 +612,28 @@ DEFINE_NATIVE_ENTRY(TransferableTypedData_factory, 0, 2) {
   intptr_t offset = 0;
   for (intptr_t i = 0; i < array_length; i++) {
     instance ^= array.At(i);
-
-    {
-      NoSafepointScope no_safepoint;
-      const auto& typed_data = TypedDataBase::Cast(instance);
-      const intptr_t length_in_bytes = typed_data.LengthInBytes();
-
-      void* source = typed_data.DataAddr(0);
-      // The memory does not overlap.
-      memcpy(data + offset, source, length_in_bytes);  // NOLINT
-      offset += length_in_bytes;
+    const auto& typed_data = TypedDataBase::Cast(instance);
+    const intptr_t length_in_bytes = typed_data.LengthInBytes();
+
+    // Copy large lists in chunks so that a multi-megabyte copy does not hold
+    // off a pending safepoint (e.g. a GC requested by another isolate of the
+    // group) for its whole duration. The data address is reloaded for every
+    // chunk since internal typed data may be moved while at a safepoint.
+    intptr_t copied = 0;
+    while (copied < length_in_bytes) {
+      const intptr_t chunk_size =
+          Utils::Minimum(length_in_bytes - copied, kTransferCopyChunkSize);
+      {
+        NoSafepointScope no_safepoint;
+        void* source = typed_data.DataAddr(copied);
+        // The memory does not overlap.
+        memcpy(data + offset, source, chunk_size);  // NOLINT
+      }
+      offset += chunk_size;
+      copied += chunk_size;
+      if (copied < length_in_bytes) {
+        thread->CheckForSafepoint();
+      }
     }
   }
   ASSERT(static_cast<uintptr_t>(offset) == total_bytes);
@@ -269,16 +269,17 @@ DEFINE_NATIVE_ENTRY(OneByteString_splitWithCharCode, 0, 2) {
       zone, GrowableObjectArray::New(16, Heap::kNew));
   String& str = String::Handle(zone);
   intptr_t start = 0;
-  intptr_t i = 0;
-  for (; i < len; i++) {
-    if (split_code == OneByteString::CharAt(receiver, i)) {
+  if ((split_code >= 0) && (split_code <= 0xFF)) {
+    const uint16_t code_unit = static_cast<uint16_t>(split_code);
+    intptr_t i;
+    while ((i = receiver.IndexOf(code_unit, start)) >= 0) {
       str = OneByteString::SubStringUnchecked(receiver, start, (i - start),
                                               Heap::kNew);
       result.Add(str);
       start = i + 1;
     }
   }
-  str = OneByteString::SubStringUnchecked(receiver, start, (i - start),
+  str = OneByteString::SubStringUnchecked(receiver, start, (len - start),
                                           Heap::kNew);
   result.Add(str);
   result.SetTypeArguments(TypeArguments::Handle(
@@ -286,6 +287,18 @@ DEFINE_NATIVE_ENTRY(OneByteString_splitWithCharCode, 0, 2) {
   return result.raw();
 }
 
+DEFINE_NATIVE_ENTRY(StringBase_indexOf, 0, 3) {
+  const String& receiver =
+      String::CheckedHandle(zone, arguments->NativeArgAt(0));
+  GET_NON_NULL_NATIVE_ARGUMENT(String, pattern, arguments->NativeArgAt(1));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, start, arguments->NativeArgAt(2));
+  const intptr_t start_ix = start.Value();
+  if ((start_ix < 0) || (start_ix > receiver.Length())) {
+    Exceptions::ThrowRangeError("start", start, 0, receiver.Length());
+  }
+  return Smi::New(receiver.IndexOf(pattern, start_ix));
+}
+
 DEFINE_NATIVE_ENTRY(OneByteString_allocate, 0, 1) {
   GET_NON_NULL_NATIVE_ARGUMENT(Integer, length_obj, arguments->NativeArgAt(0));
   const int64_t length = length_obj.AsInt64Value();
@@ -530,6 +543,14 @@ DEFINE_NATIVE_ENTRY(String_concat, 0, 2) {
   const String& receiver =
       String::CheckedHandle(zone, arguments->NativeArgAt(0));
   GET_NON_NULL_NATIVE_ARGUMENT(String, b, arguments->NativeArgAt(1));
+  // Strings are immutable, so appending to or onto an empty string, as the
+  // first step of building up a string does, need not copy.
+  if (b.Length() == 0) {
+    return receiver.raw();
+  }
+  if (receiver.Length() == 0) {
+    return b.raw();
+  }
   return String::Concat(receiver, b);
 }
 
@@ -602,4 +623,86 @@ DEFINE_NATIVE_ENTRY(StringBuffer_createStringFromUint16Array, 0, 3) {
   return result.raw();
 }
 
+// Returns true if units is one of the VM's Uint8List implementations, after
+// checking that 0 <= from <= to <= units.length.
+static bool CheckUint8ListRange(const Instance& units,
+                                const Smi& from,
+                                const Smi& to) {
+  const intptr_t cid = units.GetClassId();
+  if ((cid != kTypedDataUint8ArrayCid) &&
+      (cid != kExternalTypedDataUint8ArrayCid) &&
+      (cid != kTypedDataUint8ArrayViewCid)) {
+    return false;
+  }
+  const intptr_t length = TypedDataBase::Cast(units).Length();
+  if ((to.Value() < 0) || (to.Value() > length)) {
+    Exceptions::ThrowRangeError("to", to, 0, length);
+  }
+  if ((from.Value() < 0) || (from.Value() > to.Value())) {
+    Exceptions::ThrowRangeError("from", from, 0, to.Value());
+  }
+  return true;
+}
+
+// Returns the number of ASCII bytes at the start of units[from:to], or -1 if
+// units is not one of the VM's Uint8List implementations.
+DEFINE_NATIVE_ENTRY(Utf8Decoder_scanOneByteCharacters, 0, 3) {
+  const Instance& units =
+      Instance::CheckedHandle(zone, arguments->NativeArgAt(0));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, from, arguments->NativeArgAt(1));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, to, arguments->NativeArgAt(2));
+  if (!CheckUint8ListRange(units, from, to)) {
+    return Smi::New(-1);
+  }
+
+  NoSafepointScope no_safepoint;
+  const uint8_t* data =
+      reinterpret_cast<const uint8_t*>(TypedDataBase::Cast(units).DataAddr(0));
+  return Smi::New(Utf8::AsciiPrefixLength(data + from.Value(),
+                                          to.Value() - from.Value()));
+}
+
+static inline bool IsPlainJsonStringChar(uint8_t ch) {
+  return (ch >= 0x20) && (ch < 0x80) && (ch != '"') && (ch != '\\');
+}
+
+// Returns the index of the first byte in units[from:to] that ends a run of
+// plain JSON string content: a quote, a backslash, a control character or a
+// non-ASCII byte. Returns -1 if units is not one of the VM's Uint8List
+// implementations.
+DEFINE_NATIVE_ENTRY(JsonUtf8Parser_skipPlainAsciiChars, 0, 3) {
+  const Instance& units =
+      Instance::CheckedHandle(zone, arguments->NativeArgAt(0));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, from, arguments->NativeArgAt(1));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, to, arguments->NativeArgAt(2));
+  if (!CheckUint8ListRange(units, from, to)) {
+    return Smi::New(-1);
+  }
+
+  const uword kOnes = static_cast<uword>(0x0101010101010101ULL);
+  const uword kHighBits = kOnes * 0x80;
+  NoSafepointScope no_safepoint;
+  const uint8_t* data =
+      reinterpret_cast<const uint8_t*>(TypedDataBase::Cast(units).DataAddr(0));
+  intptr_t i = from.Value();
+  const intptr_t end = to.Value();
+  for (; (i + kWordSize) <= end; i += kWordSize) {
+    const uword word = ReadUnaligned(reinterpret_cast<const uword*>(&data[i]));
+    const uword quotes = word ^ (kOnes * '"');
+    const uword backslashes = word ^ (kOnes * '\\');
+    // Sets the high bit of a byte if any byte is zero (or, for the first
+    // term, below 0x20). May flag bytes after a hit, never without one.
+    const uword special = ((word - kOnes * 0x20) & ~word) |
+                          ((quotes - kOnes) & ~quotes) |
+                          ((backslashes - kOnes) & ~backslashes) | word;
+    if ((special & kHighBits) != 0) {
+      break;
+    }
+  }
+  while ((i < end) && IsPlainJsonStringChar(data[i])) {
+    i++;
+  }
+  return Smi::New(i);
+}
+
 }  // namespace dart
@@ -177,6 +177,442 @@ DEFINE_NATIVE_ENTRY(TypedData_setRange, 0, 7) {
   return Bool::False().raw();
 }
 
+// Bulk operations on ranges of elements. The receiver may be internal or
+// external typed data or a view; the inner data pointer of all three is
+// accessed through TypedDataBase::DataAddr.
+
+static uint8_t* ElementAddr(const TypedDataBase& array, intptr_t index) {
+  return reinterpret_cast<uint8_t*>(array.DataAddr(0)) +
+         index * array.ElementSizeInBytes();
+}
+
+static void ElementRangeCheck(const TypedDataBase& array,
+                              intptr_t start,
+                              intptr_t end) {
+  const intptr_t element_size = array.ElementSizeInBytes();
+  if (start > end) {
+    Exceptions::ThrowRangeError("start", Integer::Handle(Integer::New(start)),
+                                0, end);
+  }
+  RangeCheck(start * element_size, (end - start) * element_size,
+             array.LengthInBytes(), element_size);
+}
+
+static bool IsIntegerElement(TypedDataElementType type) {
+  return (type >= kInt8ArrayElement) && (type <= kUint64ArrayElement);
+}
+
+static bool IsDoubleElement(TypedDataElementType type) {
+  return (type == kFloat32ArrayElement) || (type == kFloat64ArrayElement);
+}
+
+// Writes the bytes of [value] as stored into an element of [type] from Dart,
+// i.e. integers are truncated or clamped. Returns false if [value] is not an
+// int or double matching the element type.
+static bool EncodeElement(TypedDataElementType type,
+                          const Instance& value,
+                          uint8_t* bytes) {
+  if (IsIntegerElement(type)) {
+    if (!value.IsInteger()) {
+      return false;
+    }
+    const int64_t v = Integer::Cast(value).AsInt64Value();
+    switch (type) {
+      case kInt8ArrayElement:
+      case kUint8ArrayElement:
+        bytes[0] = static_cast<uint8_t>(v);
+        return true;
+      case kUint8ClampedArrayElement:
+        bytes[0] = (v < 0) ? 0 : (v > 0xFF) ? 0xFF : static_cast<uint8_t>(v);
+        return true;
+      case kInt16ArrayElement:
+      case kUint16ArrayElement:
+        StoreUnaligned(reinterpret_cast<uint16_t*>(bytes),
+                       static_cast<uint16_t>(v));
+        return true;
+      case kInt32ArrayElement:
+      case kUint32ArrayElement:
+        StoreUnaligned(reinterpret_cast<uint32_t*>(bytes),
+                       static_cast<uint32_t>(v));
+        return true;
+      default:
+        StoreUnaligned(reinterpret_cast<int64_t*>(bytes), v);
+        return true;
+    }
+  }
+  if (IsDoubleElement(type)) {
+    if (!value.IsDouble()) {
+      return false;
+    }
+    const double v = Double::Cast(value).value();
+    if (type == kFloat32ArrayElement) {
+      StoreUnaligned(reinterpret_cast<float*>(bytes), static_cast<float>(v));
+    } else {
+      StoreUnaligned(reinterpret_cast<double*>(bytes), v);
+    }
+    return true;
+  }
+  return false;
+}
+
+// Fills elements [start, end) with [value]. Returns false, leaving the
+// elements unchanged, if [value] cannot be stored in bulk.
+DEFINE_NATIVE_ENTRY(TypedData_fillRange, 0, 4) {
+  GET_NON_NULL_NATIVE_ARGUMENT(TypedDataBase, array, arguments->NativeArgAt(0));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, start, arguments->NativeArgAt(1));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, end, arguments->NativeArgAt(2));
+  const Instance& value =
+      Instance::CheckedHandle(zone, arguments->NativeArgAt(3));
+  ElementRangeCheck(array, start.Value(), end.Value());
+  uint8_t bytes[sizeof(int64_t)];
+  if (!EncodeElement(array.ElementType(), value, bytes)) {
+    return Bool::False().raw();
+  }
+  const intptr_t element_size = array.ElementSizeInBytes();
+  const intptr_t length_in_bytes = (end.Value() - start.Value()) * element_size;
+  if (length_in_bytes == 0) {
+    return Bool::True().raw();
+  }
+  NoSafepointScope no_safepoint;
+  uint8_t* data = ElementAddr(array, start.Value());
+  if (element_size == 1) {
+    memset(data, bytes[0], length_in_bytes);
+  } else {
+    // Double the filled prefix until it covers the range.
+    memmove(data, bytes, element_size);
+    intptr_t filled = element_size;
+    while (filled < length_in_bytes) {
+      const intptr_t chunk = Utils::Minimum(filled, length_in_bytes - filled);
+      memmove(data + filled, data, chunk);
+      filled += chunk;
+    }
+  }
+  return Bool::True().raw();
+}
+
+template <typename T>
+static intptr_t FindElement(const T* data, intptr_t length, T value) {
+  for (intptr_t i = 0; i < length; i++) {
+    if (data[i] == value) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// Returns whether the int [v] can be loaded from an element of [type].
+static bool IsLoadableInteger(TypedDataElementType type, int64_t v) {
+  switch (type) {
+    case kInt8ArrayElement:
+      return Utils::IsInt(8, v);
+    case kUint8ArrayElement:
+    case kUint8ClampedArrayElement:
+      return Utils::IsUint(8, v);
+    case kInt16ArrayElement:
+      return Utils::IsInt(16, v);
+    case kUint16ArrayElement:
+      return Utils::IsUint(16, v);
+    case kInt32ArrayElement:
+      return Utils::IsInt(32, v);
+    case kUint32ArrayElement:
+      return Utils::IsUint(32, v);
+    default:
+      // 64-bit elements are loaded as int64, so every int can match.
+      return true;
+  }
+}
+
+// Returns the index of the first element in [start, end) that is == to
+// [element], or -1.
+DEFINE_NATIVE_ENTRY(TypedData_indexOf, 0, 4) {
+  GET_NON_NULL_NATIVE_ARGUMENT(TypedDataBase, array, arguments->NativeArgAt(0));
+  const Instance& element =
+      Instance::CheckedHandle(zone, arguments->NativeArgAt(1));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, start, arguments->NativeArgAt(2));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, end, arguments->NativeArgAt(3));
+  ElementRangeCheck(array, start.Value(), end.Value());
+  const TypedDataElementType type = array.ElementType();
+  const intptr_t length = end.Value() - start.Value();
+  intptr_t index = -1;
+  if (IsIntegerElement(type) && element.IsInteger()) {
+    const int64_t v = Integer::Cast(element).AsInt64Value();
+    if (!IsLoadableInteger(type, v) || length == 0) {
+      return Smi::New(-1);
+    }
+    NoSafepointScope no_safepoint;
+    const uint8_t* data = ElementAddr(array, start.Value());
+    switch (type) {
+      case kInt8ArrayElement:
+      case kUint8ArrayElement:
+      case kUint8ClampedArrayElement: {
+        const void* found = memchr(data, static_cast<uint8_t>(v), length);
+        index = (found == nullptr)
+                    ? -1
+                    : reinterpret_cast<const uint8_t*>(found) - data;
+        break;
+      }
+      case kInt16ArrayElement:
+      case kUint16ArrayElement:
+        index = FindElement(reinterpret_cast<const uint16_t*>(data), length,
+                            static_cast<uint16_t>(v));
+        break;
+      case kInt32ArrayElement:
+      case kUint32ArrayElement:
+        index = FindElement(reinterpret_cast<const uint32_t*>(data), length,
+                            static_cast<uint32_t>(v));
+        break;
+      default:
+        index = FindElement(reinterpret_cast<const int64_t*>(data), length, v);
+        break;
+    }
+  } else if (IsDoubleElement(type) && element.IsDouble()) {
+    // NaN is not == to anything, and -0.0 == 0.0.
+    const double v = Double::Cast(element).value();
+    NoSafepointScope no_safepoint;
+    const uint8_t* data = ElementAddr(array, start.Value());
+    if (type == kFloat32ArrayElement) {
+      const float* floats = reinterpret_cast<const float*>(data);
+      for (intptr_t i = 0; i < length; i++) {
+        if (static_cast<double>(floats[i]) == v) {
+          index = i;
+          break;
+        }
+      }
+    } else {
+      index = FindElement(reinterpret_cast<const double*>(data), length, v);
+    }
+  }
+  return Smi::New((index < 0) ? -1 : start.Value() + index);
+}
+
+// Returns whether [a] and [b] have the same elements, or null if they have
+// element types that are not compared here.
+DEFINE_NATIVE_ENTRY(TypedData_equals, 0, 2) {
+  GET_NON_NULL_NATIVE_ARGUMENT(TypedDataBase, a, arguments->NativeArgAt(0));
+  GET_NON_NULL_NATIVE_ARGUMENT(TypedDataBase, b, arguments->NativeArgAt(1));
+  TypedDataElementType a_type = a.ElementType();
+  TypedDataElementType b_type = b.ElementType();
+  // These pairs load the same values from the same bytes.
+  if (a_type == kUint8ClampedArrayElement) a_type = kUint8ArrayElement;
+  if (b_type == kUint8ClampedArrayElement) b_type = kUint8ArrayElement;
+  if (a_type == kUint64ArrayElement) a_type = kInt64ArrayElement;
+  if (b_type == kUint64ArrayElement) b_type = kInt64ArrayElement;
+  if (a_type != b_type ||
+      !(IsIntegerElement(a_type) || IsDoubleElement(a_type))) {
+    return Object::null();
+  }
+  const intptr_t length = a.Length();
+  if (length != b.Length()) {
+    return Bool::False().raw();
+  }
+  if (length == 0) {
+    return Bool::True().raw();
+  }
+  NoSafepointScope no_safepoint;
+  const uint8_t* a_data = ElementAddr(a, 0);
+  const uint8_t* b_data = ElementAddr(b, 0);
+  if (IsIntegerElement(a_type)) {
+    return Bool::Get(memcmp(a_data, b_data, a.LengthInBytes()) == 0).raw();
+  }
+  if (a_type == kFloat32ArrayElement) {
+    const float* a_floats = reinterpret_cast<const float*>(a_data);
+    const float* b_floats = reinterpret_cast<const float*>(b_data);
+    for (intptr_t i = 0; i < length; i++) {
+      if (a_floats[i] != b_floats[i]) {
+        return Bool::False().raw();
+      }
+    }
+  } else {
+    const double* a_doubles = reinterpret_cast<const double*>(a_data);
+    const double* b_doubles = reinterpret_cast<const double*>(b_data);
+    for (intptr_t i = 0; i < length; i++) {
+      if (a_doubles[i] != b_doubles[i]) {
+        return Bool::False().raw();
+      }
+    }
+  }
+  return Bool::True().raw();
+}
+
+// Element conversions with the semantics of loading each element in Dart and
+// storing it into the destination: integers wrap or clamp, and integers
+// become doubles as by int.toDouble. The loops are simple enough for the C++
+// compiler to vectorize.
+
+template <typename Dst, typename Src>
+static void ConvertIntegers(Dst* dst, const Src* src, intptr_t length) {
+  for (intptr_t i = 0; i < length; i++) {
+    dst[i] = static_cast<Dst>(static_cast<int64_t>(src[i]));
+  }
+}
+
+template <typename Src>
+static void ClampIntegers(uint8_t* dst, const Src* src, intptr_t length) {
+  for (intptr_t i = 0; i < length; i++) {
+    const int64_t v = static_cast<int64_t>(src[i]);
+    dst[i] = (v < 0) ? 0 : (v > 0xFF) ? 0xFF : static_cast<uint8_t>(v);
+  }
+}
+
+template <typename Dst, typename Src>
+static void ConvertIntegersToDoubles(Dst* dst,
+                                     const Src* src,
+                                     intptr_t length) {
+  for (intptr_t i = 0; i < length; i++) {
+    const double v = static_cast<double>(static_cast<int64_t>(src[i]));
+    dst[i] = static_cast<Dst>(v);
+  }
+}
+
+template <typename Dst, typename Src>
+static void ConvertDoubles(Dst* dst, const Src* src, intptr_t length) {
+  for (intptr_t i = 0; i < length; i++) {
+    dst[i] = static_cast<Dst>(src[i]);
+  }
+}
+
+template <typename Src>
+static bool ConvertFromIntegers(TypedDataElementType to,
+                                void* dst,
+                                const Src* src,
+                                intptr_t length) {
+  switch (to) {
+    case kInt8ArrayElement:
+      ConvertIntegers(static_cast<int8_t*>(dst), src, length);
+      return true;
+    case kUint8ArrayElement:
+      ConvertIntegers(static_cast<uint8_t*>(dst), src, length);
+      return true;
+    case kUint8ClampedArrayElement:
+      ClampIntegers(static_cast<uint8_t*>(dst), src, length);
+      return true;
+    case kInt16ArrayElement:
+      ConvertIntegers(static_cast<int16_t*>(dst), src, length);
+      return true;
+    case kUint16ArrayElement:
+      ConvertIntegers(static_cast<uint16_t*>(dst), src, length);
+      return true;
+    case kInt32ArrayElement:
+      ConvertIntegers(static_cast<int32_t*>(dst), src, length);
+      return true;
+    case kUint32ArrayElement:
+      ConvertIntegers(static_cast<uint32_t*>(dst), src, length);
+      return true;
+    case kInt64ArrayElement:
+      ConvertIntegers(static_cast<int64_t*>(dst), src, length);
+      return true;
+    case kUint64ArrayElement:
+      ConvertIntegers(static_cast<uint64_t*>(dst), src, length);
+      return true;
+    case kFloat32ArrayElement:
+      ConvertIntegersToDoubles(static_cast<float*>(dst), src, length);
+      return true;
+    case kFloat64ArrayElement:
+      ConvertIntegersToDoubles(static_cast<double*>(dst), src, length);
+      return true;
+    default:
+      return false;
+  }
+}
+
+template <typename Src>
+static bool ConvertFromDoubles(TypedDataElementType to,
+                               void* dst,
+                               const Src* src,
+                               intptr_t length) {
+  switch (to) {
+    case kFloat32ArrayElement:
+      ConvertDoubles(static_cast<float*>(dst), src, length);
+      return true;
+    case kFloat64ArrayElement:
+      ConvertDoubles(static_cast<double*>(dst), src, length);
+      return true;
+    default:
+      // Doubles are not implicitly converted to integers.
+      return false;
+  }
+}
+
+static bool ConvertElements(TypedDataElementType to,
+                            void* dst,
+                            TypedDataElementType from,
+                            const void* src,
+                            intptr_t length) {
+  switch (from) {
+    case kInt8ArrayElement:
+      return ConvertFromIntegers(to, dst, static_cast<const int8_t*>(src),
+                                 length);
+    case kUint8ArrayElement:
+    case kUint8ClampedArrayElement:
+      return ConvertFromIntegers(to, dst, static_cast<const uint8_t*>(src),
+                                 length);
+    case kInt16ArrayElement:
+      return ConvertFromIntegers(to, dst, static_cast<const int16_t*>(src),
+                                 length);
+    case kUint16ArrayElement:
+      return ConvertFromIntegers(to, dst, static_cast<const uint16_t*>(src),
+                                 length);
+    case kInt32ArrayElement:
+      return ConvertFromIntegers(to, dst, static_cast<const int32_t*>(src),
+                                 length);
+    case kUint32ArrayElement:
+      return ConvertFromIntegers(to, dst, static_cast<const uint32_t*>(src),
+                                 length);
+    case kInt64ArrayElement:
+    case kUint64ArrayElement:
+      return ConvertFromIntegers(to, dst, static_cast<const int64_t*>(src),
+                                 length);
+    case kFloat32ArrayElement:
+      return ConvertFromDoubles(to, dst, static_cast<const float*>(src),
+                                length);
+    case kFloat64ArrayElement:
+      return ConvertFromDoubles(to, dst, static_cast<const double*>(src),
+                                length);
+    default:
+      return false;
+  }
+}
+
+// Stores the elements of [from] starting at [skipCount] into the elements
+// [start, end) of the receiver, converting them to its element type. Returns
+// false, leaving the receiver unchanged, for conversions not done here.
+DEFINE_NATIVE_ENTRY(TypedData_convertRange, 0, 5) {
+  GET_NON_NULL_NATIVE_ARGUMENT(TypedDataBase, dst, arguments->NativeArgAt(0));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, start, arguments->NativeArgAt(1));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, end, arguments->NativeArgAt(2));
+  GET_NON_NULL_NATIVE_ARGUMENT(TypedDataBase, src, arguments->NativeArgAt(3));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, skip_count, arguments->NativeArgAt(4));
+  const intptr_t length = end.Value() - start.Value();
+  ElementRangeCheck(dst, start.Value(), end.Value());
+  ElementRangeCheck(src, skip_count.Value(), skip_count.Value() + length);
+  const TypedDataElementType to = dst.ElementType();
+  const TypedDataElementType from = src.ElementType();
+  const bool convertible =
+      (IsIntegerElement(from) || IsDoubleElement(from)) &&
+      (IsDoubleElement(to) || (IsIntegerElement(to) && IsIntegerElement(from)));
+  if (!convertible) {
+    return Bool::False().raw();
+  }
+  if (length == 0) {
+    return Bool::True().raw();
+  }
+  const intptr_t src_length_in_bytes = length * src.ElementSizeInBytes();
+  const intptr_t dst_length_in_bytes = length * dst.ElementSizeInBytes();
+  NoSafepointScope no_safepoint;
+  const uint8_t* src_data = ElementAddr(src, skip_count.Value());
+  uint8_t* dst_data = ElementAddr(dst, start.Value());
+  // Views of the same buffer may overlap.
+  if ((src_data < dst_data + dst_length_in_bytes) &&
+      (dst_data < src_data + src_length_in_bytes)) {
+    uint8_t* buffer = zone->Alloc<uint8_t>(src_length_in_bytes);
+    memmove(buffer, src_data, src_length_in_bytes);
+    src_data = buffer;
+  }
+  const bool converted = ConvertElements(to, dst_data, from, src_data, length);
+  ASSERT(converted);
+  return Bool::Get(converted).raw();
+}
+
 // We check the length parameter against a possible maximum length for the
 // array based on available physical addressable memory on the system.
 //
@@ -7,6 +7,7 @@
 #include "platform/allocation.h"
 #include "platform/globals.h"
 #include "platform/syslog.h"
+#include "platform/utils.h"
 
 namespace dart {
 
@@ -40,6 +41,24 @@ const uint32_t Utf8::kOverlongMinimum[7] = {0,  // Padding.
                                             0x0,     0x80,       0x800,
                                             0x10000, 0xFFFFFFFF, 0xFFFFFFFF};
 
+// Scans a word at a time until a byte with its high bit set is found.
+intptr_t Utf8::AsciiPrefixLength(const uint8_t* utf8_array,
+                                 intptr_t array_len) {
+  const uword kHighBits = static_cast<uword>(0x8080808080808080ULL);
+  intptr_t i = 0;
+  for (; (i + kWordSize) <= array_len; i += kWordSize) {
+    const uword word =
+        ReadUnaligned(reinterpret_cast<const uword*>(&utf8_array[i]));
+    if ((word & kHighBits) != 0) {
+      break;
+    }
+  }
+  while ((i < array_len) && (utf8_array[i] <= kMaxOneByteChar)) {
+    i++;
+  }
+  return i;
+}
+
 // Returns the most restricted coding form in which the sequence of utf8
 // characters in 'utf8_array' can be represented in, and the number of
 // code units needed in that form.
@@ -49,6 +68,14 @@ intptr_t Utf8::CodeUnitCount(const uint8_t* utf8_array,
   intptr_t len = 0;
   Type char_type = kLatin1;
   for (intptr_t i = 0; i < array_len; i++) {
+    // Every ASCII byte is one Latin-1 code unit.
+    const intptr_t ascii_len =
+        AsciiPrefixLength(&utf8_array[i], array_len - i);
+    len += ascii_len;
+    i += ascii_len;
+    if (i == array_len) {
+      break;
+    }
     uint8_t code_unit = utf8_array[i];
     if (!IsTrailByte(code_unit)) {
       ++len;
@@ -70,6 +97,10 @@ intptr_t Utf8::CodeUnitCount(const uint8_t* utf8_array,
 bool Utf8::IsValid(const uint8_t* utf8_array, intptr_t array_len) {
   intptr_t i = 0;
   while (i < array_len) {
+    i += AsciiPrefixLength(&utf8_array[i], array_len - i);
+    if (i == array_len) {
+      break;
+    }
     uint32_t ch = utf8_array[i] & 0xFF;
     intptr_t j = 1;
     if (ch >= 0x80) {
@@ -197,16 +228,27 @@ bool Utf8::DecodeToLatin1(const uint8_t* utf8_array,
                           intptr_t len) {
   intptr_t i = 0;
   intptr_t j = 0;
-  intptr_t num_bytes;
-  for (; (i < array_len) && (j < len); i += num_bytes, ++j) {
+  while ((i < array_len) && (j < len)) {
+    // Copy runs of ASCII directly.
+    const intptr_t ascii_len = AsciiPrefixLength(
+        &utf8_array[i], Utils::Minimum(array_len - i, len - j));
+    memmove(&dst[j], &utf8_array[i], ascii_len);
+    i += ascii_len;
+    j += ascii_len;
+    if ((i == array_len) || (j == len)) {
+      break;
+    }
+
     int32_t ch;
     ASSERT(IsLatin1SequenceStart(utf8_array[i]));
-    num_bytes = Utf8::Decode(&utf8_array[i], (array_len - i), &ch);
+    intptr_t num_bytes = Utf8::Decode(&utf8_array[i], (array_len - i), &ch);
     if (ch == -1) {
       return false;  // Invalid input.
     }
     ASSERT(Utf::IsLatin1(ch));
     dst[j] = ch;
+    i += num_bytes;
+    ++j;
   }
   if ((i < array_len) && (j == len)) {
     return false;  // Output overflow.
@@ -220,11 +262,22 @@ bool Utf8::DecodeToUTF16(const uint8_t* utf8_array,
                          intptr_t len) {
   intptr_t i = 0;
   intptr_t j = 0;
-  intptr_t num_bytes;
-  for (; (i < array_len) && (j < len); i += num_bytes, ++j) {
+  while ((i < array_len) && (j < len)) {
+    // Widen runs of ASCII directly.
+    const intptr_t ascii_len = AsciiPrefixLength(
+        &utf8_array[i], Utils::Minimum(array_len - i, len - j));
+    for (intptr_t k = 0; k < ascii_len; k++) {
+      dst[j + k] = utf8_array[i + k];
+    }
+    i += ascii_len;
+    j += ascii_len;
+    if ((i == array_len) || (j == len)) {
+      break;
+    }
+
     int32_t ch;
     bool is_supplementary = IsSupplementarySequenceStart(utf8_array[i]);
-    num_bytes = Utf8::Decode(&utf8_array[i], (array_len - i), &ch);
+    intptr_t num_bytes = Utf8::Decode(&utf8_array[i], (array_len - i), &ch);
     if (ch == -1) {
       return false;  // Invalid input.
     }
@@ -235,6 +288,8 @@ bool Utf8::DecodeToUTF16(const uint8_t* utf8_array,
     } else {
       dst[j] = ch;
     }
+    i += num_bytes;
+    ++j;
   }
   if ((i < array_len) && (j == len)) {
     return false;  // Output overflow.
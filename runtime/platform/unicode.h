@@ -53,6 +53,11 @@ class Utf8 : AllStatic {
   // Returns true if 'utf8_array' is a valid UTF-8 string.
   static bool IsValid(const uint8_t* utf8_array, intptr_t array_len);
 
+  // Returns the number of leading ASCII bytes in 'utf8_array'. Scans a word
+  // at a time.
+  static intptr_t AsciiPrefixLength(const uint8_t* utf8_array,
+                                    intptr_t array_len);
+
   static intptr_t Length(int32_t ch);
   static intptr_t Length(const String& str);
 
@@ -0,0 +1,126 @@
+// Copyright (c) 2019, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// VMOptions=--compilation-counter-threshold=-1
+//
+// Test that the interpreter branches correctly when an int or double
+// comparison is directly followed by a conditional jump, for forward jumps
+// (if statements, while conditions) and backward jumps (do-while
+// conditions), with both short and wide jump offsets.
+
+import 'package:expect/expect.dart';
+
+@pragma('vm:never-inline')
+List<int> countForwardInt(int n) {
+  int lt = 0, le = 0, gt = 0, ge = 0;
+  for (int i = 0; i < n; i++) {
+    if (i < 5) lt++;
+    if (i <= 5) le++;
+    if (i > 5) gt++;
+    if (i >= 5) ge++;
+  }
+  return [lt, le, gt, ge];
+}
+
+@pragma('vm:never-inline')
+List<int> countBackwardInt(int n) {
+  int lt = 0, le = 0, gt = 0, ge = 0;
+  int i = 0;
+  do {
+    lt++;
+  } while (++i < n);
+  i = 0;
+  do {
+    le++;
+  } while (++i <= n);
+  i = n;
+  do {
+    gt++;
+  } while (--i > 0);
+  i = n;
+  do {
+    ge++;
+  } while (--i >= 0);
+  return [lt, le, gt, ge];
+}
+
+@pragma('vm:never-inline')
+List<int> countForwardDouble(double n) {
+  int lt = 0, le = 0, gt = 0, ge = 0;
+  for (double d = 0.0; d < n; d += 0.5) {
+    if (d < 2.5) lt++;
+    if (d <= 2.5) le++;
+    if (d > 2.5) gt++;
+    if (d >= 2.5) ge++;
+  }
+  return [lt, le, gt, ge];
+}
+
+@pragma('vm:never-inline')
+List<int> countBackwardDouble(double n) {
+  int lt = 0, le = 0, gt = 0, ge = 0;
+  double d = 0.0;
+  do {
+    lt++;
+  } while ((d += 0.5) < n);
+  d = 0.0;
+  do {
+    le++;
+  } while ((d += 0.5) <= n);
+  d = n;
+  do {
+    gt++;
+  } while ((d -= 0.5) > 0.0);
+  d = n;
+  do {
+    ge++;
+  } while ((d -= 0.5) >= 0.0);
+  return [lt, le, gt, ge];
+}
+
+@pragma('vm:never-inline')
+int sink(int x) => x;
+
+// The loop bodies below are long enough to need wide jump offsets.
+@pragma('vm:never-inline')
+int wideForward(int n) {
+  int taken = 0;
+  for (int i = 0; i < n; i++) {
+    if (i < 3) {
+      taken += sink(1) + sink(2) + sink(3) + sink(4) + sink(5) + sink(6);
+      taken += sink(1) + sink(2) + sink(3) + sink(4) + sink(5) + sink(6);
+      taken += sink(1) + sink(2) + sink(3) + sink(4) + sink(5) + sink(6);
+      taken += sink(1) + sink(2) + sink(3) + sink(4) + sink(5) + sink(6);
+      taken += sink(1) + sink(2) + sink(3) + sink(4) + sink(5) + sink(6);
+      taken += sink(1) + sink(2) + sink(3) + sink(4) + sink(5) + sink(6);
+    }
+  }
+  return taken;
+}
+
+@pragma('vm:never-inline')
+int wideBackward(double n) {
+  int taken = 0;
+  double d = 0.0;
+  do {
+    taken += sink(1) + sink(2) + sink(3) + sink(4) + sink(5) + sink(6);
+    taken += sink(1) + sink(2) + sink(3) + sink(4) + sink(5) + sink(6);
+    taken += sink(1) + sink(2) + sink(3) + sink(4) + sink(5) + sink(6);
+    taken += sink(1) + sink(2) + sink(3) + sink(4) + sink(5) + sink(6);
+    taken += sink(1) + sink(2) + sink(3) + sink(4) + sink(5) + sink(6);
+    taken += sink(1) + sink(2) + sink(3) + sink(4) + sink(5) + sink(6);
+  } while ((d += 1.0) < n);
+  return taken;
+}
+
+main() {
+  for (int i = 0; i < 3; i++) {
+    Expect.listEquals([5, 6, 4, 5], countForwardInt(10));
+    Expect.listEquals([10, 11, 10, 11], countBackwardInt(10));
+    Expect.listEquals([5, 6, 4, 5], countForwardDouble(5.0));
+    Expect.listEquals([10, 11, 10, 11], countBackwardDouble(5.0));
+    Expect.equals(3 * 126, wideForward(10));
+    Expect.equals(4 * 126, wideBackward(4.0));
+  }
+}
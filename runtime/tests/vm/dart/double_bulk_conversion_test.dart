@@ -0,0 +1,92 @@
+// Copyright (c) 2019, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Test that formatDoubles and parseDoubles from dart:_internal agree with
+// double.toString and double.parse, including special values, strings that
+// are not plain literals, and lists the native code does not handle.
+
+import 'dart:collection';
+import 'dart:_internal' show formatDoubles, parseDoubles;
+import 'dart:typed_data';
+
+import 'package:expect/expect.dart';
+
+const values = const <double>[
+  0.0,
+  -0.0,
+  1.0,
+  -1.5,
+  0.1,
+  1e21,
+  1.5e-7,
+  123456789.125,
+  double.nan,
+  double.infinity,
+  double.negativeInfinity,
+  double.maxFinite,
+  double.minPositive,
+];
+
+void expectSameDoubles(List<double> expected, Float64List actual) {
+  Expect.equals(expected.length, actual.length);
+  for (int i = 0; i < expected.length; i++) {
+    if (expected[i].isNaN) {
+      Expect.isTrue(actual[i].isNaN);
+    } else {
+      Expect.identical(expected[i], actual[i]);
+      Expect.equals(expected[i].isNegative, actual[i].isNegative);
+    }
+  }
+}
+
+void testFormat() {
+  final list = new Float64List.fromList(values);
+  Expect.equals(values.map((d) => d.toString()).join(","), formatDoubles(list));
+  Expect.equals(
+      values.map((d) => d.toString()).join(" | "), formatDoubles(list, " | "));
+  Expect.equals("", formatDoubles(new Float64List(0)));
+  Expect.equals("-0.0", formatDoubles(new Float64List.fromList([-0.0])));
+
+  final view = new Float64List.view(list.buffer, 8, 3);
+  Expect.equals("-0.0,1.0,-1.5", formatDoubles(view));
+}
+
+void testParse() {
+  final sources = values.map((d) => d.toString()).toList(growable: false);
+  expectSameDoubles(values, parseDoubles(sources));
+
+  // Growable lists are handled natively too.
+  final growable = values.map((d) => d.toString()).toList();
+  expectSameDoubles(values, parseDoubles(growable));
+
+  // Strings that are not plain literals fall back to double.parse.
+  final mixed = <String>[
+    "1.5",
+    " 2.5 ",
+    "-0.0",
+    "+3",
+    "\n-Infinity",
+    "NaN",
+    ".5",
+    "1e400",
+    "7",
+  ];
+  expectSameDoubles(mixed.map(double.parse).toList(), parseDoubles(mixed));
+
+  // Lists that are neither fixed length nor growable lists are parsed
+  // element by element.
+  final view = new UnmodifiableListView<String>(mixed);
+  expectSameDoubles(mixed.map(double.parse).toList(), parseDoubles(view));
+
+  Expect.equals(0, parseDoubles(<String>[]).length);
+  Expect.throws(
+      () => parseDoubles(["1.0", "one", "3.0"]), (e) => e is FormatException);
+}
+
+main() {
+  for (int i = 0; i < 3; i++) {
+    testFormat();
+    testParse();
+  }
+}
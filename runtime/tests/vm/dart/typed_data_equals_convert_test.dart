@@ -0,0 +1,144 @@
+// Copyright (c) 2019, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Test that typedDataEquals and convertTypedData from dart:_internal agree
+// with comparing and storing the elements one by one.
+
+import 'dart:_internal' show convertTypedData, typedDataEquals;
+import 'dart:typed_data';
+
+import 'package:expect/expect.dart';
+
+const n = 100;
+
+bool elementsEqual(List a, List b) {
+  if (a.length != b.length) return false;
+  for (int i = 0; i < a.length; i++) {
+    if (a[i] != b[i]) return false;
+  }
+  return true;
+}
+
+void expectEquals(bool expected, TypedData a, TypedData b) {
+  Expect.equals(expected, elementsEqual(a as List, b as List));
+  Expect.equals(expected, typedDataEquals(a, b));
+  Expect.equals(expected, typedDataEquals(b, a));
+}
+
+testEquals() {
+  var a = new Int32List(n);
+  var b = new Int32List(n);
+  for (int i = 0; i < n; i++) a[i] = b[i] = i * 7 - 300;
+  expectEquals(true, a, b);
+  b[n - 1]++;
+  expectEquals(false, a, b);
+  expectEquals(false, a, new Int32List(n - 1));
+  expectEquals(true, new Int32List(0), new Int32List(0));
+
+  // Views compare their own elements only.
+  var view = new Int32List.view(a.buffer, 4, n - 1);
+  expectEquals(true, view, new Int32List.fromList(a.sublist(1)));
+
+  // NaN is not == to itself, and -0.0 == 0.0.
+  var doubles = new Float64List(n)..fillRange(0, n, 1.5);
+  var other = new Float64List.fromList(doubles);
+  expectEquals(true, doubles, other);
+  doubles[10] = -0.0;
+  other[10] = 0.0;
+  expectEquals(true, doubles, other);
+  doubles[20] = double.nan;
+  other[20] = double.nan;
+  expectEquals(false, doubles, doubles);
+  expectEquals(false, doubles, other);
+  var floats = new Float32List(n);
+  floats[30] = -0.0;
+  expectEquals(true, floats, new Float32List(n));
+  floats[30] = double.nan;
+  expectEquals(false, floats, floats);
+
+  // Uint64 and Int64 elements load the same values from the same bytes.
+  var int64 = new Int64List(n)..fillRange(0, n, -1);
+  var uint64 = new Uint64List(n)..fillRange(0, n, -1);
+  expectEquals(true, int64, uint64);
+  uint64[50] = 0x7FFFFFFFFFFFFFFF;
+  expectEquals(false, int64, uint64);
+
+  // Lists of different element types are compared element by element.
+  var int8 = new Int8List(n)..fillRange(0, n, -1);
+  var uint8 = new Uint8List(n)..fillRange(0, n, 255);
+  expectEquals(false, int8, uint8);
+  int8.fillRange(0, n, 100);
+  uint8.fillRange(0, n, 100);
+  expectEquals(true, int8, uint8);
+  expectEquals(true, uint8, new Uint8ClampedList(n)..fillRange(0, n, 100));
+  expectEquals(true, int8, new Int16List(n)..fillRange(0, n, 100));
+  expectEquals(true, int8, new Float64List(n)..fillRange(0, n, 100.0));
+  expectEquals(false, int8, new Float64List(n)..fillRange(0, n, 100.5));
+  expectEquals(true, new Float32List(n)..fillRange(0, n, 0.5),
+      new Float64List(n)..fillRange(0, n, 0.5));
+  expectEquals(false, new Float32List(n)..fillRange(0, n, 0.1),
+      new Float64List(n)..fillRange(0, n, 0.1));
+}
+
+void expectConverted(List<double> target, int start, List<int> source) {
+  for (int i = 0; i < source.length; i++) {
+    var expected = source[i].toDouble();
+    if (target is Float32List) {
+      expected = new Float32List.fromList([expected])[0];
+    }
+    Expect.equals(expected, target[start + i], "index $i");
+  }
+}
+
+testConvertIntToDouble() {
+  var int32 = new Int32List(n);
+  for (int i = 0; i < n; i++) int32[i] = (i - 50) * 0x1000001;
+  var float64 = new Float64List(n + 10);
+  convertTypedData(float64, 10, int32);
+  Expect.equals(0.0, float64[9]);
+  expectConverted(float64, 10, int32);
+  var float32 = new Float32List(n);
+  convertTypedData(float32, 0, int32);
+  expectConverted(float32, 0, int32);
+
+  // Large ints round like int.toDouble.
+  var int64 = new Int64List.fromList([
+    (1 << 53) + 1,
+    -(1 << 53) - 1,
+    0x7FFFFFFFFFFFFFFF,
+    -0x8000000000000000,
+  ]);
+  convertTypedData(float64, 0, int64);
+  expectConverted(float64, 0, int64);
+  convertTypedData(float32, 0, int64);
+  expectConverted(float32, 0, int64);
+
+  // Uint64 elements load as signed ints.
+  var uint64 = new Uint64List.fromList([-1, 1 << 63, 42]);
+  convertTypedData(float64, 0, uint64);
+  Expect.listEquals(
+      [-1.0, -9223372036854775808.0, 42.0], float64.sublist(0, 3));
+
+  var uint8 = new Uint8List(n)..fillRange(0, n, 200);
+  convertTypedData(float64, 0, uint8);
+  expectConverted(float64, 0, uint8);
+
+  // A view of the target only gets its own range.
+  var view = new Float64List.view(float64.buffer, 8, 4);
+  convertTypedData(view, 1, new Int16List.fromList([-3, 4, 5]));
+  Expect.listEquals([200.0, 200.0, -3.0, 4.0, 5.0, 200.0],
+      float64.sublist(0, 6));
+
+  Expect.throws(() => convertTypedData(new Float64List(3), 1, int32),
+      (e) => e is RangeError);
+  Expect.throws(() => convertTypedData(new Int32List(n + 10), 0, float64),
+      (e) => e is ArgumentError);
+}
+
+main() {
+  for (int i = 0; i < 3; i++) {
+    testEquals();
+    testConvertIntToDouble();
+  }
+}
@@ -733,6 +733,151 @@ BENCHMARK(LargeMap) {
   benchmark->set_score(elapsed_time);
 }
 
+// Script driving the end-to-end messaging benchmarks below. Messages are
+// posted through SendPort.send and delivered by the isolate's message handler
+// (Dart_RunLoop), so both the PostMessage and the HandleMessage side are
+// measured.
+static const char* kMessagingScript =
+    "import 'dart:isolate';\n"
+    "import 'dart:typed_data';\n"
+    "\n"
+    "int remaining = 0;\n"
+    "List<RawReceivePort> ports = new List<RawReceivePort>();\n"
+    "List<int> latencies;\n"
+    "\n"
+    "makeMessage(int shape) {\n"
+    "  switch (shape) {\n"
+    "    case 0: return 'abcdefghij' * 100;\n"
+    "    case 1: return new Uint8List(64 * 1024);\n"
+    "    case 2:\n"
+    "      var map = {};\n"
+    "      for (int i = 0; i < 10; i++) {\n"
+    "        map['key$i'] = {'id': i, 'values': [i, i + 1, i + 2]};\n"
+    "      }\n"
+    "      return map;\n"
+    "    case 3:\n"
+    "      return new List.generate(16, (_) => ports[0].sendPort);\n"
+    "  }\n"
+    "  return null;\n"
+    "}\n"
+    "\n"
+    "void post(int shape, int portCount, int messageCount) {\n"
+    "  remaining = messageCount;\n"
+    "  for (int i = 0; i < portCount; i++) {\n"
+    "    ports.add(new RawReceivePort((_) {\n"
+    "      if (--remaining == 0) ports.forEach((p) => p.close());\n"
+    "    }));\n"
+    "  }\n"
+    "  var message = makeMessage(shape);\n"
+    "  for (int i = 0; i < messageCount; i++) {\n"
+    "    ports[i % portCount].sendPort.send(message);\n"
+    "  }\n"
+    "}\n"
+    "\n"
+    "void pingPong(int count) {\n"
+    "  var watch = new Stopwatch()..start();\n"
+    "  latencies = new List<int>();\n"
+    "  RawReceivePort port;\n"
+    "  port = new RawReceivePort((int sent) {\n"
+    "    latencies.add(watch.elapsedMicroseconds - sent);\n"
+    "    if (latencies.length == count) {\n"
+    "      port.close();\n"
+    "      return;\n"
+    "    }\n"
+    "    port.sendPort.send(watch.elapsedMicroseconds);\n"
+    "  });\n"
+    "  port.sendPort.send(watch.elapsedMicroseconds);\n"
+    "}\n"
+    "\n"
+    "int percentile(int p) {\n"
+    "  latencies.sort();\n"
+    "  return latencies[(latencies.length - 1) * p ~/ 100];\n"
+    "}\n";
+
+enum MessageShape {
+  kStringMessage = 0,
+  kTypedDataMessage = 1,
+  kNestedMapMessage = 2,
+  kSendPortMessage = 3,
+  kNullMessage = 4,
+};
+
+// Posts [message_count] messages of the given [shape] spread over
+// [port_count] receive ports and runs the message loop until all of them
+// have been handled.
+static int64_t MeasureMessageThroughput(MessageShape shape,
+                                        intptr_t port_count,
+                                        intptr_t message_count,
+                                        const char* name) {
+  Dart_Handle lib = TestCase::LoadTestScript(kMessagingScript, NULL);
+  EXPECT_VALID(lib);
+  Dart_Handle args[3];
+  args[0] = Dart_NewInteger(shape);
+  args[1] = Dart_NewInteger(port_count);
+  args[2] = Dart_NewInteger(message_count);
+
+  Timer timer(true, name);
+  timer.Start();
+  Dart_Handle result = Dart_Invoke(lib, NewString("post"), 3, args);
+  EXPECT_VALID(result);
+  result = Dart_RunLoop();
+  EXPECT_VALID(result);
+  timer.Stop();
+  return timer.TotalElapsedTime();
+}
+
+// Bounces messages off a single port, one at a time, and returns the given
+// [percentile] of the observed send-to-handle latency in microseconds.
+static int64_t MeasureMessageLatency(intptr_t percentile) {
+  Dart_Handle lib = TestCase::LoadTestScript(kMessagingScript, NULL);
+  EXPECT_VALID(lib);
+  Dart_Handle arg = Dart_NewInteger(10000);
+  Dart_Handle result = Dart_Invoke(lib, NewString("pingPong"), 1, &arg);
+  EXPECT_VALID(result);
+  result = Dart_RunLoop();
+  EXPECT_VALID(result);
+  arg = Dart_NewInteger(percentile);
+  result = Dart_Invoke(lib, NewString("percentile"), 1, &arg);
+  EXPECT_VALID(result);
+  int64_t latency = 0;
+  result = Dart_IntegerToInt64(result, &latency);
+  EXPECT_VALID(result);
+  return latency;
+}
+
+BENCHMARK(StringMessageThroughput) {
+  benchmark->set_score(MeasureMessageThroughput(
+      kStringMessage, 1, 10000, "String Message Throughput"));
+}
+
+BENCHMARK(TypedDataMessageThroughput) {
+  benchmark->set_score(MeasureMessageThroughput(
+      kTypedDataMessage, 1, 1000, "Typed Data Message Throughput"));
+}
+
+BENCHMARK(NestedMapMessageThroughput) {
+  benchmark->set_score(MeasureMessageThroughput(
+      kNestedMapMessage, 1, 1000, "Nested Map Message Throughput"));
+}
+
+BENCHMARK(SendPortMessageThroughput) {
+  benchmark->set_score(MeasureMessageThroughput(
+      kSendPortMessage, 1, 10000, "Send Port Message Throughput"));
+}
+
+BENCHMARK(FanOutMessageThroughput) {
+  benchmark->set_score(MeasureMessageThroughput(
+      kNullMessage, 64, 64000, "Fan Out Message Throughput"));
+}
+
+BENCHMARK(MessageLatencyP50) {
+  benchmark->set_score(MeasureMessageLatency(50));
+}
+
+BENCHMARK(MessageLatencyP99) {
+  benchmark->set_score(MeasureMessageLatency(99));
+}
+
 BENCHMARK_MEMORY(InitialRSS) {
   benchmark->set_score(bin::Process::MaxRSS());
 }
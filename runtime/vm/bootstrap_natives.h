@@ -46,6 +46,10 @@ namespace dart {
   V(Integer_parse, 1)                                                          \
   V(Integer_shlFromInteger, 2)                                                 \
   V(Integer_shrFromInteger, 2)                                                 \
+  V(Bigint_mulDigits, 5)                                                       \
+  V(Bigint_divRemDigits, 5)                                                    \
+  V(Bigint_toDecimalString, 2)                                                 \
+  V(Bigint_parseDecimal, 1)                                                    \
   V(Bool_fromEnvironment, 3)                                                   \
   V(CapabilityImpl_factory, 1)                                                 \
   V(CapabilityImpl_equals, 2)                                                  \
@@ -96,6 +100,8 @@ namespace dart {
   V(Double_toInt, 1)                                                           \
   V(Double_parse, 3)                                                           \
   V(Double_toString, 1)                                                        \
+  V(Double_formatAll, 2)                                                       \
+  V(Double_parseAll, 3)                                                        \
   V(Double_toStringAsFixed, 2)                                                 \
   V(Double_toStringAsExponential, 2)                                           \
   V(Double_toStringAsPrecision, 2)                                             \
@@ -120,6 +126,7 @@ namespace dart {
   V(StringBase_createFromCodePoints, 3)                                        \
   V(StringBase_substringUnchecked, 3)                                          \
   V(StringBase_joinReplaceAllResult, 4)                                        \
+  V(StringBase_indexOf, 3)                                                     \
   V(StringBuffer_createStringFromUint16Array, 3)                               \
   V(OneByteString_substringUnchecked, 3)                                       \
   V(OneByteString_splitWithCharCode, 2)                                        \
@@ -136,6 +143,8 @@ namespace dart {
   V(String_toLowerCase, 1)                                                     \
   V(String_toUpperCase, 1)                                                     \
   V(String_concatRange, 3)                                                     \
+  V(Utf8Decoder_scanOneByteCharacters, 3)                                      \
+  V(JsonUtf8Parser_skipPlainAsciiChars, 3)                                     \
   V(Math_sqrt, 1)                                                              \
   V(Math_sin, 1)                                                               \
   V(Math_cos, 1)                                                               \
@@ -188,6 +197,10 @@ namespace dart {
   V(TypedData_Float64x2Array_new, 2)                                           \
   V(TypedData_length, 1)                                                       \
   V(TypedData_setRange, 7)                                                     \
+  V(TypedData_fillRange, 4)                                                    \
+  V(TypedData_indexOf, 4)                                                      \
+  V(TypedData_equals, 2)                                                       \
+  V(TypedData_convertRange, 5)                                                 \
   V(TypedData_GetInt8, 2)                                                      \
   V(TypedData_SetInt8, 3)                                                      \
   V(TypedData_GetUint8, 2)                                                     \
@@ -61,6 +61,62 @@ class RawCodeKeyValueTrait {
 
 typedef DirectChainedHashMap<RawCodeKeyValueTrait> RawCodeSet;
 
+struct HotCode {
+  RawCode* code;
+  intptr_t usage;
+  intptr_t index;
+};
+
+static int CompareHotCode(const HotCode* a, const HotCode* b) {
+  if (a->usage != b->usage) {
+    return a->usage > b->usage ? -1 : 1;
+  }
+  return a->index < b->index ? -1 : (a->index > b->index ? 1 : 0);
+}
+
+// Functions only have a positive usage counter in AOT if it was loaded from
+// the type feedback of a training run. Move their code to the front, hottest
+// first, so the frequently executed instructions are packed together. The
+// relative order of all other code is preserved.
+static void OrderCodeObjectsByUsage(GrowableArray<RawCode*>* code_objects) {
+  Code& code = Code::Handle();
+  Object& owner = Object::Handle();
+  GrowableArray<HotCode> hot;
+  for (intptr_t i = 0; i < code_objects->length(); i++) {
+    code = (*code_objects)[i];
+    owner = code.owner();
+    if (!owner.IsFunction()) {
+      continue;
+    }
+    const intptr_t usage = Function::Cast(owner).usage_counter();
+    if (usage > 0) {
+      hot.Add({code.raw(), usage, i});
+    }
+  }
+  if (hot.is_empty()) {
+    return;
+  }
+  hot.Sort(CompareHotCode);
+
+  RawCodeSet hot_set;
+  for (const HotCode& entry : hot) {
+    hot_set.Insert(entry.code);
+  }
+  GrowableArray<RawCode*> ordered(code_objects->length());
+  for (const HotCode& entry : hot) {
+    ordered.Add(entry.code);
+  }
+  for (RawCode* code : *code_objects) {
+    if (!hot_set.HasKey(code)) {
+      ordered.Add(code);
+    }
+  }
+  code_objects->Clear();
+  for (RawCode* code : ordered) {
+    code_objects->Add(code);
+  }
+}
+
 #endif  // defined(DART_PRECOMPILER) && !defined(TARGET_ARCH_IA32)
 
 static RawObject* AllocateUninitialized(PageSpace* old_space, intptr_t size) {
@@ -4746,6 +4802,10 @@ void Serializer::Serialize() {
         static_cast<CodeSerializationCluster*>(clusters_by_cid_[kCodeCid])
             ->discovered_objects();
 
+    if (!vm_) {
+      OrderCodeObjectsByUsage(code_objects);
+    }
+
     GrowableArray<ImageWriterCommand> writer_commands;
     RelocateCodeObjects(vm_, code_objects, &writer_commands);
     image_writer_->PrepareForSerialization(&writer_commands);
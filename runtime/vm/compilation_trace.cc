@@ -18,6 +18,12 @@ namespace dart {
 #if !defined(DART_PRECOMPILED_RUNTIME)
 
 DEFINE_FLAG(bool, trace_compilation_trace, false, "Trace compilation trace.");
+DEFINE_FLAG(bool,
+            lazy_type_feedback_optimization,
+            false,
+            "Do not optimize hot functions while loading type feedback, but "
+            "leave them to be optimized (in the background, if enabled) on "
+            "their first invocation.");
 
 CompilationTraceSaver::CompilationTraceSaver(Zone* zone)
     : buf_(zone, 1 * MB),
@@ -634,14 +640,24 @@ RawObject* TypeFeedbackLoader::LoadFeedback(ReadStream* stream) {
     }
   }
 
-  while (functions_to_compile_.Length() > 0) {
-    func_ ^= functions_to_compile_.RemoveLast();
-
-    if (Compiler::CanOptimizeFunction(thread_, func_) &&
-        (func_.usage_counter() >= FLAG_optimization_counter_threshold)) {
-      error_ = Compiler::CompileOptimizedFunction(thread_, func_);
-      if (error_.IsError()) {
-        return error_.raw();
+  // The loaded usage counters are already above the optimization threshold
+  // for hot functions, so in lazy mode their first invocation will trigger
+  // optimization. Functions that are not called again are never optimized.
+  if (FLAG_lazy_type_feedback_optimization) {
+    if (FLAG_trace_compilation_trace) {
+      THR_Print("Deferring optimization of %" Pd " functions\n",
+                functions_to_compile_.Length());
+    }
+  } else {
+    while (functions_to_compile_.Length() > 0) {
+      func_ ^= functions_to_compile_.RemoveLast();
+
+      if (Compiler::CanOptimizeFunction(thread_, func_) &&
+          (func_.usage_counter() >= FLAG_optimization_counter_threshold)) {
+        error_ = Compiler::CompileOptimizedFunction(thread_, func_);
+        if (error_.IsError()) {
+          return error_.raw();
+        }
       }
     }
   }
@@ -683,6 +699,15 @@ RawObject* TypeFeedbackLoader::CheckHeader() {
   }
   stream_->Advance(version_len);
 
+  if (FLAG_precompiled_mode) {
+    // The precompiler only consumes usage counts, which do not depend on the
+    // JIT configuration the feedback was recorded with.
+    const char* features =
+        reinterpret_cast<const char*>(stream_->AddressOfCurrentPosition());
+    stream_->Advance(Utils::StrNLen(features, stream_->PendingBytes()) + 1);
+    return Error::null();
+  }
+
   char* expected_features = CompilerFlags();
   ASSERT(expected_features != NULL);
   const intptr_t expected_len = strlen(expected_features);
@@ -731,7 +756,8 @@ RawObject* TypeFeedbackLoader::LoadClasses() {
 RawObject* TypeFeedbackLoader::LoadFields() {
   for (intptr_t cid = kNumPredefinedCids; cid < num_cids_; cid++) {
     cls_ = ReadClassByName();
-    bool skip = cls_.IsNull();
+    // Field guards are not used by precompiled code.
+    bool skip = cls_.IsNull() || FLAG_precompiled_mode;
 
     intptr_t num_fields = ReadInt();
     if (!skip && (num_fields > 0)) {
@@ -827,6 +853,13 @@ RawObject* TypeFeedbackLoader::LoadFunction() {
     }
   }
 
+  if (!skip && FLAG_precompiled_mode) {
+    // Call site feedback is keyed by JIT deopt ids. The precompiler only uses
+    // the usage counter, to place hot code together in the snapshot.
+    func_.set_usage_counter(usage);
+    skip = true;
+  }
+
   if (!skip) {
     error_ = Compiler::CompileFunction(thread_, func_);
     if (error_.IsError()) {
@@ -269,18 +269,28 @@ void BlockScheduler::ReorderBlocksAOT(FlowGraph* flow_graph) {
   }
 
   // Follow all indirect predecessors which unconditionally will end up in a
-  // throwing block.
+  // throwing block, either through a goto or because every successor of
+  // their branch throws. The graph entry has to stay in front.
   while (worklist.length() > 0) {
     auto block = worklist.RemoveLast();
     for (intptr_t i = 0; i < block->PredecessorCount(); ++i) {
       auto predecessor = block->PredecessorAt(i);
-      if (predecessor->last_instruction()->IsGoto()) {
-        const intptr_t preorder_nr = predecessor->preorder_number();
-        if (!is_terminating[preorder_nr]) {
-          is_terminating[preorder_nr] = true;
-          worklist.Add(predecessor);
+      const intptr_t preorder_nr = predecessor->preorder_number();
+      if (is_terminating[preorder_nr] || predecessor->IsGraphEntry()) {
+        continue;
+      }
+      auto last = predecessor->last_instruction();
+      bool all_successors_terminating = true;
+      for (intptr_t j = 0; j < last->SuccessorCount(); ++j) {
+        if (!is_terminating[last->SuccessorAt(j)->preorder_number()]) {
+          all_successors_terminating = false;
+          break;
         }
       }
+      if (all_successors_terminating) {
+        is_terminating[preorder_nr] = true;
+        worklist.Add(predecessor);
+      }
     }
   }
 
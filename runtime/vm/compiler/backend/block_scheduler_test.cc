@@ -0,0 +1,129 @@
+// Copyright (c) 2019, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/compiler/backend/block_scheduler.h"
+
+#include "vm/compiler/backend/block_builder.h"
+#include "vm/compiler/backend/il_test_helper.h"
+#include "vm/object.h"
+#include "vm/unit_test.h"
+
+namespace dart {
+
+using compiler::BlockBuilder;
+
+static intptr_t IndexInCodegenOrder(FlowGraph* flow_graph,
+                                    BlockEntryInstr* block) {
+  auto order = flow_graph->CodegenBlockOrder(true);
+  for (intptr_t i = 0; i < order->length(); i++) {
+    if ((*order)[i] == block) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+ISOLATE_UNIT_TEST_CASE(BlockScheduler_MovesThrowingDiamondsAOT) {
+  SetFlagScope<bool> sfs(&FLAG_precompiled_mode, true);
+  CompilerState S(thread);
+
+  FlowGraphBuilderHelper H;
+
+  // We are going to build the following graph:
+  //
+  // B0[graph_entry]:
+  // B1[function_entry]:
+  //   v0 <- Parameter(0)
+  //   if v0 == null then B2 else B3
+  // B2:
+  //   if v0 == 1 then B4 else B5
+  // B3:
+  //   if v0 == 2 then B6 else B7
+  // B4:
+  //   Throw(v0)
+  // B5:
+  //   Throw(v0)
+  // B6:
+  //   Throw(v0)
+  // B7:
+  //   goto B8
+  // B8:
+  //   Return(v0)
+  //
+  // Both arms of B2 throw, so B2, B4 and B5 are cold. B3 has an arm which
+  // continues normally, so only B6 is cold.
+
+  Definition* v0;
+  auto b1 = H.flow_graph()->graph_entry()->normal_entry();
+  auto b2 = H.TargetEntry();
+  auto b3 = H.TargetEntry();
+  auto b4 = H.TargetEntry();
+  auto b5 = H.TargetEntry();
+  auto b6 = H.TargetEntry();
+  auto b7 = H.TargetEntry();
+  auto b8 = H.JoinEntry();
+
+  auto compare = [&](Definition* left, Definition* right) {
+    return new StrictCompareInstr(TokenPosition::kNoSource, Token::kEQ_STRICT,
+                                  new Value(left), new Value(right),
+                                  /*needs_number_check=*/false,
+                                  S.GetNextDeoptId());
+  };
+
+  {
+    BlockBuilder builder(H.flow_graph(), b1);
+    v0 = builder.AddParameter(0, /*with_frame=*/true);
+    builder.AddBranch(
+        compare(v0, H.flow_graph()->GetConstant(Object::Handle())), b2, b3);
+  }
+
+  {
+    BlockBuilder builder(H.flow_graph(), b2);
+    builder.AddBranch(compare(v0, H.IntConstant(1)), b4, b5);
+  }
+
+  {
+    BlockBuilder builder(H.flow_graph(), b3);
+    builder.AddBranch(compare(v0, H.IntConstant(2)), b6, b7);
+  }
+
+  for (auto block : {b4, b5, b6}) {
+    BlockBuilder builder(H.flow_graph(), block);
+    builder.AddInstruction(new ThrowInstr(TokenPosition::kNoSource,
+                                          S.GetNextDeoptId(), new Value(v0)));
+  }
+
+  {
+    BlockBuilder builder(H.flow_graph(), b7);
+    builder.AddInstruction(new GotoInstr(b8, S.GetNextDeoptId()));
+  }
+
+  {
+    BlockBuilder builder(H.flow_graph(), b8);
+    builder.AddReturn(new Value(v0));
+  }
+
+  H.FinishGraph();
+
+  BlockScheduler::ReorderBlocks(H.flow_graph());
+
+  FlowGraph* flow_graph = H.flow_graph();
+  EXPECT_EQ(flow_graph->reverse_postorder().length(),
+            flow_graph->CodegenBlockOrder(true)->length());
+  EXPECT_EQ(0, IndexInCodegenOrder(flow_graph, flow_graph->graph_entry()));
+  EXPECT_EQ(1, IndexInCodegenOrder(flow_graph, b1));
+
+  // The hot path keeps its order in front of all cold blocks.
+  const intptr_t b3_index = IndexInCodegenOrder(flow_graph, b3);
+  const intptr_t b7_index = IndexInCodegenOrder(flow_graph, b7);
+  const intptr_t b8_index = IndexInCodegenOrder(flow_graph, b8);
+  EXPECT(b3_index < b7_index);
+  EXPECT(b7_index < b8_index);
+  EXPECT_EQ(4, b8_index);
+  for (auto block : {b2, b4, b5, b6}) {
+    EXPECT(IndexInCodegenOrder(flow_graph, block) > b8_index);
+  }
+}
+
+}  // namespace dart
@@ -2584,13 +2584,27 @@ static void AddToSortedListOfRanges(GrowableArray<LiveRange*>* list,
     return;
   }
 
-  for (intptr_t i = list->length() - 1; i >= 0; i--) {
-    if (ShouldBeAllocatedBefore(range, (*list)[i])) {
-      list->InsertAt(i + 1, range);
-      return;
+  // The list is sorted by decreasing start. Split siblings usually start
+  // close to the current allocation position and belong at the end.
+  if (ShouldBeAllocatedBefore(range, list->Last())) {
+    list->Add(range);
+    return;
+  }
+
+  // Otherwise binary search for the insertion point. This saves comparing
+  // against every range, but InsertAt still moves all ranges after the
+  // insertion point, so a single insertion stays linear.
+  intptr_t lo = 0;
+  intptr_t hi = list->length() - 1;  // (*list)[hi] starts after range.
+  while (lo < hi) {
+    const intptr_t mid = lo + (hi - lo) / 2;
+    if (ShouldBeAllocatedBefore(range, (*list)[mid])) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
     }
   }
-  list->InsertAt(0, range);
+  list->InsertAt(lo, range);
 }
 
 void FlowGraphAllocator::AddToUnallocated(LiveRange* range) {
@@ -3808,6 +3808,60 @@ void DeadCodeElimination::EliminateDeadCode(FlowGraph* flow_graph) {
   }
 }
 
+// Innermost loops that are known to run at most this many iterations do not
+// need a stack overflow (preemption) check on every iteration: the time spent
+// in the loop is bounded, and any call inside it checks on entry.
+static const int64_t kMaxTripCountWithoutStackCheck = 1024;
+
+// Returns true if the control induction of [loop] has constant bounds that
+// limit the loop to at most kMaxTripCountWithoutStackCheck iterations.
+static bool HasSmallConstantTripCount(LoopInfo* loop) {
+  InductionVar* control = loop->control();
+  int64_t stride = 0;
+  int64_t begin = 0;
+  if ((control == nullptr) || !InductionVar::IsLinear(control, &stride) ||
+      !InductionVar::IsConstant(control->initial(), &begin) ||
+      !Utils::IsInt(32, begin)) {
+    return false;
+  }
+  for (auto bound : control->bounds()) {
+    int64_t end = 0;
+    if ((bound.branch_ == loop->header()->last_instruction()) &&
+        InductionVar::IsConstant(bound.limit_, &end) &&
+        Utils::IsInt(32, end)) {
+      ASSERT((stride == 1) || (stride == -1));
+      const int64_t trip_count = (stride == 1) ? end - begin : begin - end;
+      return trip_count <= kMaxTripCountWithoutStackCheck;
+    }
+  }
+  return false;
+}
+
+void CheckStackOverflowElimination::EliminateLoopStackOverflow(
+    FlowGraph* graph) {
+  const LoopHierarchy& loop_hierarchy = graph->GetLoopHierarchy();
+  if (loop_hierarchy.num_loops() == 0) {
+    return;
+  }
+  loop_hierarchy.ComputeInduction();
+
+  for (BlockIterator block_it = graph->reverse_postorder_iterator();
+       !block_it.Done(); block_it.Advance()) {
+    BlockEntryInstr* block = block_it.Current();
+    LoopInfo* loop = block->loop_info();
+    if ((loop == nullptr) || (loop->inner() != nullptr) ||
+        !HasSmallConstantTripCount(loop)) {
+      continue;
+    }
+    for (ForwardInstructionIterator it(block); !it.Done(); it.Advance()) {
+      CheckStackOverflowInstr* instr = it.Current()->AsCheckStackOverflow();
+      if ((instr != nullptr) && instr->in_loop()) {
+        it.RemoveCurrentFromGraph();
+      }
+    }
+  }
+}
+
 void CheckStackOverflowElimination::EliminateStackOverflow(FlowGraph* graph) {
   CheckStackOverflowInstr* first_stack_overflow_instr = NULL;
   for (BlockIterator block_it = graph->reverse_postorder_iterator();
@@ -145,6 +145,10 @@ class CheckStackOverflowElimination : public AllStatic {
  public:
   // For leaf functions with only a single [StackOverflowInstr] we remove it.
   static void EliminateStackOverflow(FlowGraph* graph);
+
+  // Removes the per-iteration [StackOverflowInstr] from innermost loops with
+  // a small constant trip count.
+  static void EliminateLoopStackOverflow(FlowGraph* graph);
 };
 
 }  // namespace dart
@@ -852,4 +852,66 @@ ISOLATE_UNIT_TEST_CASE(LoadOptimizer_RedundantStoresAndLoads) {
   EXPECT_EQ(1, aft_stores);
 }
 
+static intptr_t CountLoopStackOverflowChecks(FlowGraph* flow_graph) {
+  intptr_t count = 0;
+  for (BlockIterator block_it = flow_graph->reverse_postorder_iterator();
+       !block_it.Done(); block_it.Advance()) {
+    for (ForwardInstructionIterator it(block_it.Current()); !it.Done();
+         it.Advance()) {
+      CheckStackOverflowInstr* check = it.Current()->AsCheckStackOverflow();
+      if ((check != nullptr) && check->in_loop()) {
+        count++;
+      }
+    }
+  }
+  return count;
+}
+
+ISOLATE_UNIT_TEST_CASE(LoopStackOverflowCheckElimination) {
+  const char* kScript = R"(
+      import 'dart:typed_data';
+
+      int shortLoop(Uint8List list) {
+        int sum = 0;
+        for (int i = 0; i < 16; i++) {
+          sum += list[i];
+        }
+        return sum;
+      }
+
+      int longLoop(Uint8List list) {
+        int sum = 0;
+        for (int i = 0; i < list.length; i++) {
+          sum += list[i];
+        }
+        return sum;
+      }
+
+      main() {
+        final list = new Uint8List(16);
+        shortLoop(list);
+        longLoop(list);
+      }
+  )";
+
+  const auto& root_library = Library::Handle(LoadTestScript(kScript));
+  Invoke(root_library, "main");
+
+  {
+    const auto& function =
+        Function::Handle(GetFunction(root_library, "shortLoop"));
+    TestPipeline pipeline(function, CompilerPass::kJIT);
+    FlowGraph* flow_graph = pipeline.RunPasses({});
+    EXPECT_EQ(0, CountLoopStackOverflowChecks(flow_graph));
+  }
+
+  {
+    const auto& function =
+        Function::Handle(GetFunction(root_library, "longLoop"));
+    TestPipeline pipeline(function, CompilerPass::kJIT);
+    FlowGraph* flow_graph = pipeline.RunPasses({});
+    EXPECT_EQ(1, CountLoopStackOverflowChecks(flow_graph));
+  }
+}
+
 }  // namespace dart
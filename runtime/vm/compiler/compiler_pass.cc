@@ -166,6 +166,20 @@ void CompilerPass::ParseFilters(const char* filter) {
   }
 }
 
+#if defined(SUPPORT_TIMELINE)
+static intptr_t CountInstructions(FlowGraph* flow_graph) {
+  intptr_t count = 0;
+  for (BlockIterator block_it = flow_graph->reverse_postorder_iterator();
+       !block_it.Done(); block_it.Advance()) {
+    for (ForwardInstructionIterator it(block_it.Current()); !it.Done();
+         it.Advance()) {
+      count++;
+    }
+  }
+  return count;
+}
+#endif  // defined(SUPPORT_TIMELINE)
+
 void CompilerPass::Run(CompilerPassState* state) const {
   if (IsFlagSet(kDisabled)) {
     return;
@@ -185,8 +199,28 @@ void CompilerPass::Run(CompilerPassState* state) const {
 
     PrintGraph(state, kTraceBefore, round);
     {
-      TIMELINE_DURATION(thread, CompilerVerbose, name());
+#if defined(SUPPORT_TIMELINE)
+      TimelineBeginEndScope tbes(thread, Timeline::GetCompilerVerboseStream(),
+                                 name());
+      // Zone::SizeInBytes walks the zone's segments, so only measure when the
+      // event is recorded.
+      const uintptr_t zone_size_before =
+          tbes.enabled() ? thread->zone()->SizeInBytes() : 0;
+#endif  // defined(SUPPORT_TIMELINE)
       repeat = DoBody(state);
+#if defined(SUPPORT_TIMELINE)
+      // Record the size of the graph the pass produced and the zone memory it
+      // consumed, to find passes that do not scale with huge methods.
+      if (tbes.enabled()) {
+        tbes.SetNumArguments(2);
+        tbes.FormatArgument(0, "instructions", "%" Pd,
+                            CountInstructions(state->flow_graph));
+        tbes.FormatArgument(
+            1, "zoneBytes", "%" Pd,
+            static_cast<intptr_t>(thread->zone()->SizeInBytes() -
+                                  zone_size_before));
+      }
+#endif  // defined(SUPPORT_TIMELINE)
       thread->CheckForSafepoint();
     }
     PrintGraph(state, kTraceAfter, round);
@@ -394,6 +428,7 @@ COMPILER_PASS(ApplyClassIds, { state->call_specializer->ApplyClassIds(); });
 COMPILER_PASS(EliminateStackOverflowChecks, {
   if (!flow_graph->IsCompiledForOsr()) {
     CheckStackOverflowElimination::EliminateStackOverflow(flow_graph);
+    CheckStackOverflowElimination::EliminateLoopStackOverflow(flow_graph);
   }
 });
 
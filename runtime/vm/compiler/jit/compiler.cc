@@ -70,6 +70,11 @@ DEFINE_FLAG(bool,
             stress_test_background_compilation,
             false,
             "Keep background compiler running all the time");
+DEFINE_FLAG(bool,
+            background_compilation_by_hotness,
+            true,
+            "Compile the hottest queued function first instead of compiling "
+            "the background compilation queue in FIFO order.");
 DEFINE_FLAG(bool,
             stop_on_excessive_deoptimization,
             false,
@@ -1092,66 +1097,86 @@ void Compiler::AbortBackgroundCompilation(intptr_t deopt_id, const char* msg) {
 // C-heap allocated background compilation queue element.
 class QueueElement {
  public:
-  explicit QueueElement(const Function& function)
-      : next_(NULL), function_(function.raw()) {}
-
-  virtual ~QueueElement() {
-    next_ = NULL;
-    function_ = Function::null();
-  }
+  // With --background_compilation_by_hotness, functions are compiled in order
+  // of their usage counter when they were queued. Functions put back on the
+  // queue because they still lack optimized code rank behind all others, so a
+  // function whose optimization keeps failing cannot starve the queue.
+  QueueElement(const Function& function, bool requeued)
+      : function_(function.raw()),
+        requeued_(FLAG_background_compilation_by_hotness && requeued),
+        usage_counter_(FLAG_background_compilation_by_hotness
+                           ? function.usage_counter()
+                           : 0),
+        sequence_(0) {}
+
+  virtual ~QueueElement() { function_ = Function::null(); }
 
   RawFunction* Function() const { return function_; }
 
-  void set_next(QueueElement* elem) { next_ = elem; }
-  QueueElement* next() const { return next_; }
-
   RawObject* function() const { return function_; }
   RawObject** function_ptr() {
     return reinterpret_cast<RawObject**>(&function_);
   }
 
+  void set_sequence(uint64_t sequence) { sequence_ = sequence; }
+
+  // Whether this element is compiled before [other]. Elements of the same
+  // rank are compiled in the order they were queued.
+  bool IsBefore(const QueueElement& other) const {
+    if (requeued_ != other.requeued_) {
+      return !requeued_;
+    }
+    if (usage_counter_ != other.usage_counter_) {
+      return usage_counter_ > other.usage_counter_;
+    }
+    return sequence_ < other.sequence_;
+  }
+
  private:
-  QueueElement* next_;
   RawFunction* function_;
+  const bool requeued_;
+  const intptr_t usage_counter_;
+  uint64_t sequence_;
 
   DISALLOW_COPY_AND_ASSIGN(QueueElement);
 };
 
 // Allocated in C-heap. Handles both input and output of background compilation.
-// It implements a FIFO queue, using Peek, Add, Remove operations.
+// It implements a priority queue using Peek, Add, Remove operations, ordered
+// by QueueElement::IsBefore. The element returned by Peek stays at the front,
+// even if a higher priority element is added, until it is removed.
 class BackgroundCompilationQueue {
  public:
-  BackgroundCompilationQueue() : first_(NULL), last_(NULL) {}
+  BackgroundCompilationQueue() : current_(NULL), next_sequence_(0) {}
   virtual ~BackgroundCompilationQueue() { Clear(); }
 
   void VisitObjectPointers(ObjectPointerVisitor* visitor) {
     ASSERT(visitor != NULL);
-    QueueElement* p = first_;
-    while (p != NULL) {
-      visitor->VisitPointer(p->function_ptr());
-      p = p->next();
+    if (current_ != NULL) {
+      visitor->VisitPointer(current_->function_ptr());
+    }
+    for (intptr_t i = 0; i < heap_.length(); i++) {
+      visitor->VisitPointer(heap_[i]->function_ptr());
     }
   }
 
-  bool IsEmpty() const { return first_ == NULL; }
+  bool IsEmpty() const { return (current_ == NULL) && heap_.is_empty(); }
 
   void Add(QueueElement* value) {
     ASSERT(value != NULL);
-    ASSERT(value->next() == NULL);
-    if (first_ == NULL) {
-      first_ = value;
-      ASSERT(last_ == NULL);
-    } else {
-      ASSERT(last_ != NULL);
-      last_->set_next(value);
-    }
-    last_ = value;
-    ASSERT(first_ != NULL && last_ != NULL);
+    value->set_sequence(next_sequence_++);
+    heap_.Add(value);
+    SiftUp(heap_.length() - 1);
   }
 
-  QueueElement* Peek() const { return first_; }
+  QueueElement* Peek() {
+    if ((current_ == NULL) && !heap_.is_empty()) {
+      current_ = RemoveFirst();
+    }
+    return current_;
+  }
 
-  RawFunction* PeekFunction() const {
+  RawFunction* PeekFunction() {
     QueueElement* e = Peek();
     if (e == NULL) {
       return Function::null();
@@ -1161,22 +1186,20 @@ class BackgroundCompilationQueue {
   }
 
   QueueElement* Remove() {
-    ASSERT(first_ != NULL);
-    QueueElement* result = first_;
-    first_ = first_->next();
-    if (first_ == NULL) {
-      last_ = NULL;
-    }
+    ASSERT(!IsEmpty());
+    QueueElement* result = Peek();
+    current_ = NULL;
     return result;
   }
 
   bool ContainsObj(const Object& obj) const {
-    QueueElement* p = first_;
-    while (p != NULL) {
-      if (p->function() == obj.raw()) {
+    if ((current_ != NULL) && (current_->function() == obj.raw())) {
+      return true;
+    }
+    for (intptr_t i = 0; i < heap_.length(); i++) {
+      if (heap_[i]->function() == obj.raw()) {
         return true;
       }
-      p = p->next();
     }
     return false;
   }
@@ -1186,12 +1209,59 @@ class BackgroundCompilationQueue {
       QueueElement* e = Remove();
       delete e;
     }
-    ASSERT((first_ == NULL) && (last_ == NULL));
+    ASSERT((current_ == NULL) && heap_.is_empty());
   }
 
  private:
-  QueueElement* first_;
-  QueueElement* last_;
+  // Binary heap operations on heap_, with the first element at index 0.
+  void SiftUp(intptr_t index) {
+    QueueElement* value = heap_[index];
+    while (index > 0) {
+      const intptr_t parent = (index - 1) / 2;
+      if (!value->IsBefore(*heap_[parent])) {
+        break;
+      }
+      heap_[index] = heap_[parent];
+      index = parent;
+    }
+    heap_[index] = value;
+  }
+
+  void SiftDown(intptr_t index) {
+    const intptr_t length = heap_.length();
+    QueueElement* value = heap_[index];
+    while (true) {
+      intptr_t child = 2 * index + 1;
+      if (child >= length) {
+        break;
+      }
+      if ((child + 1 < length) && heap_[child + 1]->IsBefore(*heap_[child])) {
+        child++;
+      }
+      if (!heap_[child]->IsBefore(*value)) {
+        break;
+      }
+      heap_[index] = heap_[child];
+      index = child;
+    }
+    heap_[index] = value;
+  }
+
+  QueueElement* RemoveFirst() {
+    ASSERT(!heap_.is_empty());
+    QueueElement* first = heap_[0];
+    QueueElement* last = heap_.RemoveLast();
+    if (!heap_.is_empty()) {
+      heap_[0] = last;
+      SiftDown(0);
+    }
+    return first;
+  }
+
+  MallocGrowableArray<QueueElement*> heap_;
+  // The element being compiled, taken off heap_ by Peek.
+  QueueElement* current_;
+  uint64_t next_sequence_;
 
   DISALLOW_COPY_AND_ASSIGN(BackgroundCompilationQueue);
 };
@@ -1252,7 +1322,7 @@ void BackgroundCompiler::Run() {
                 FLAG_stress_test_background_compilation) {
               if (old.is_background_optimizable() &&
                   Compiler::CanOptimizeFunction(thread, old)) {
-                QueueElement* repeat_qelem = new QueueElement(old);
+                QueueElement* repeat_qelem = new QueueElement(old, true);
                 function_queue()->Add(repeat_qelem);
               }
             }
@@ -1289,7 +1359,7 @@ void BackgroundCompiler::Compile(const Function& function) {
   if (function_queue()->ContainsObj(function)) {
     return;
   }
-  QueueElement* elem = new QueueElement(function);
+  QueueElement* elem = new QueueElement(function, false);
   function_queue()->Add(elem);
   ml.Notify();
 }
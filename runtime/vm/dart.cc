@@ -210,6 +210,7 @@ char* Dart::Init(const uint8_t* vm_isolate_snapshot,
   NativeSymbolResolver::Init();
   NOT_IN_PRODUCT(Profiler::Init());
   SemiSpace::Init();
+  HeapPage::Init();
   NOT_IN_PRODUCT(Metric::Init());
   StoreBuffer::Init();
   MarkingStack::Init();
@@ -482,6 +483,14 @@ char* Dart::Cleanup() {
   }
   Isolate::KillAllIsolates(Isolate::kInternalKillMsg);
 
+  // Isolates waiting in spawn pools never run their message handlers, so they
+  // have to be shut down explicitly.
+  if (FLAG_trace_shutdown) {
+    OS::PrintErr("[+%" Pd64 "ms] SHUTDOWN: Shutting down prespawned isolates\n",
+                 UptimeMillis());
+  }
+  IsolateGroup::ShutdownAllPrespawnedIsolates();
+
   // Wait for all isolates, but the service and the vm isolate to shut down.
   // Only do that if there is a service isolate running.
   if (ServiceIsolate::IsRunning() || KernelIsolate::IsRunning()) {
@@ -580,6 +589,7 @@ char* Dart::Cleanup() {
   StoreBuffer::Cleanup();
   Object::Cleanup();
   SemiSpace::Cleanup();
+  HeapPage::Cleanup();
   StubCode::Cleanup();
 #if defined(SUPPORT_TIMELINE)
   if (FLAG_trace_shutdown) {
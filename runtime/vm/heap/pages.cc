@@ -6,6 +6,7 @@
 
 #include "platform/address_sanitizer.h"
 #include "platform/assert.h"
+#include "platform/memory_sanitizer.h"
 #include "vm/dart.h"
 #include "vm/heap/become.h"
 #include "vm/heap/compactor.h"
@@ -42,14 +43,84 @@ DEFINE_FLAG(bool,
             false,
             "Print free list statistics after a GC");
 DEFINE_FLAG(bool, log_growth, false, "Log PageSpace growth policy decisions.");
+DEFINE_FLAG(int,
+            old_page_cache_size,
+            16,
+            "The number of old space data pages of shut down isolates that are "
+            "kept mapped for reuse by any isolate.");
+
+Mutex* HeapPage::cache_mutex_ = NULL;
+VirtualMemory** HeapPage::cache_ = NULL;
+intptr_t HeapPage::cache_size_ = 0;
+intptr_t HeapPage::cache_capacity_ = 0;
+
+void HeapPage::Init() {
+  if (cache_mutex_ == NULL) {
+    cache_mutex_ = new Mutex();
+  }
+  ASSERT(cache_mutex_ != NULL);
+  ASSERT(cache_ == NULL);
+  ASSERT(cache_size_ == 0);
+  if (FLAG_old_page_cache_size > 0) {
+    cache_capacity_ = FLAG_old_page_cache_size;
+    cache_ = new VirtualMemory*[cache_capacity_];
+  }
+}
+
+void HeapPage::Cleanup() {
+  MutexLocker ml(cache_mutex_);
+  for (intptr_t i = 0; i < cache_size_; i++) {
+    delete cache_[i];
+  }
+  delete[] cache_;
+  cache_ = NULL;
+  cache_size_ = 0;
+  cache_capacity_ = 0;
+}
+
+VirtualMemory* HeapPage::TakeCachedMemory() {
+  MutexLocker ml(cache_mutex_);
+  if (cache_size_ == 0) {
+    return NULL;
+  }
+  VirtualMemory* memory = cache_[--cache_size_];
+  // Behave like freshly mapped memory.
+  MSAN_UNPOISON(memory->address(), memory->size());
+  return memory;
+}
+
+intptr_t HeapPage::CachedPageCount() {
+  MutexLocker ml(cache_mutex_);
+  return cache_size_;
+}
+
+bool HeapPage::TryCacheMemory(VirtualMemory* memory) {
+  ASSERT(memory->size() == kPageSize);
+#if defined(DEBUG)
+  memset(memory->address(), Heap::kZapByte, memory->size());
+#endif
+  MSAN_POISON(memory->address(), memory->size());
+  MutexLocker ml(cache_mutex_);
+  if (cache_size_ >= cache_capacity_) {
+    return false;
+  }
+  cache_[cache_size_++] = memory;
+  return true;
+}
 
 HeapPage* HeapPage::Allocate(intptr_t size_in_words,
                              PageType type,
                              const char* name) {
   const bool executable = type == kExecutable;
 
-  VirtualMemory* memory = VirtualMemory::AllocateAligned(
-      size_in_words << kWordSizeLog2, kPageSize, executable, name);
+  VirtualMemory* memory = NULL;
+  if (!executable && (size_in_words == kPageSizeInWords)) {
+    memory = TakeCachedMemory();
+  }
+  if (memory == NULL) {
+    memory = VirtualMemory::AllocateAligned(size_in_words << kWordSizeLog2,
+                                            kPageSize, executable, name);
+  }
   if (memory == NULL) {
     return NULL;
   }
@@ -68,7 +139,7 @@ HeapPage* HeapPage::Allocate(intptr_t size_in_words,
   return result;
 }
 
-void HeapPage::Deallocate() {
+void HeapPage::Deallocate(bool can_cache) {
   if (card_table_ != NULL) {
     free(card_table_);
     card_table_ = NULL;
@@ -81,8 +152,13 @@ void HeapPage::Deallocate() {
   }
 
   // For a regular heap pages, the memory for this object will become
-  // unavailable after the delete below.
-  delete memory_;
+  // unavailable after the delete or caching below.
+  VirtualMemory* memory = memory_;
+  if (can_cache && !image_page && (type_ == kData) &&
+      (memory->size() == kPageSize) && TryCacheMemory(memory)) {
+    return;
+  }
+  delete memory;
 
   // For a heap page from a snapshot, the HeapPage object lives in the malloc
   // heap rather than the page itself.
@@ -398,10 +474,14 @@ void PageSpace::FreePage(HeapPage* page, HeapPage* previous_page) {
       }
     }
   }
-  // TODO(iposva): Consider adding to a pool of empty pages.
   page->Deallocate();
 }
 
+bool PageSpace::CanCachePages() const {
+  // The VM isolate's pages may be write protected.
+  return (heap_ != NULL) && (heap_->isolate() != Dart::vm_isolate());
+}
+
 void PageSpace::FreeLargePage(HeapPage* page, HeapPage* previous_page) {
   // Thread should be at a safepoint when this code is called and hence
   // it is not necessary to lock large_pages_.
@@ -417,10 +497,14 @@ void PageSpace::FreeLargePage(HeapPage* page, HeapPage* previous_page) {
 }
 
 void PageSpace::FreePages(HeapPage* pages) {
+  // Only pages released when the whole old space goes away are cached. Pages
+  // freed by the sweeper or compactor are unmapped, so that a running isolate
+  // still returns memory it no longer needs to the OS.
+  const bool can_cache = CanCachePages();
   HeapPage* page = pages;
   while (page != NULL) {
     HeapPage* next = page->next();
-    page->Deallocate();
+    page->Deallocate(can_cache);
     page = next;
   }
 }
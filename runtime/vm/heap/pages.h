@@ -142,6 +142,13 @@ class HeapPage {
   }
   void VisitRememberedCards(ObjectPointerVisitor* visitor);
 
+  // Regular sized data pages of isolates that shut down are kept in a process
+  // wide cache (see --old_page_cache_size), so that isolates spawned within
+  // the same process reuse already mapped memory.
+  static void Init();
+  static void Cleanup();
+  static intptr_t CachedPageCount();
+
  private:
   void set_object_end(uword value) {
     ASSERT((value & kObjectAlignmentMask) == kOldObjectAlignmentOffset);
@@ -154,8 +161,17 @@ class HeapPage {
                             const char* name);
 
   // Deallocate the virtual memory backing this page. The page pointer to this
-  // page becomes immediately inaccessible.
-  void Deallocate();
+  // page becomes immediately inaccessible. If [can_cache] is true, regular
+  // sized data pages are returned to the page cache instead if it has room.
+  void Deallocate(bool can_cache = false);
+
+  static VirtualMemory* TakeCachedMemory();
+  static bool TryCacheMemory(VirtualMemory* memory);
+
+  static Mutex* cache_mutex_;
+  static VirtualMemory** cache_;
+  static intptr_t cache_size_;
+  static intptr_t cache_capacity_;
 
   VirtualMemory* memory_;
   HeapPage* next_;
@@ -473,6 +489,7 @@ class PageSpace {
   void TruncateLargePage(HeapPage* page, intptr_t new_object_size_in_bytes);
   void FreeLargePage(HeapPage* page, HeapPage* previous_page);
   void FreePages(HeapPage* pages);
+  bool CanCachePages() const;
 
   void CollectGarbageAtSafepoint(bool compact,
                                  bool finalize,
@@ -31,4 +31,22 @@ TEST_CASE(Pages) {
   delete space;
 }
 
+ISOLATE_UNIT_TEST_CASE(PagesReusedAfterFree) {
+  PageSpace* space = new PageSpace(thread->heap(), 4 * MBInWords);
+  uword block = space->TryAllocate(8 * kWordSize, HeapPage::kData,
+                                   PageSpace::kForceGrowth);
+  EXPECT(block != 0);
+  delete space;
+
+  // A cached page is handed out again instead of mapping a new one.
+  const intptr_t cached = HeapPage::CachedPageCount();
+  EXPECT(cached > 0);
+  space = new PageSpace(thread->heap(), 4 * MBInWords);
+  uword new_block = space->TryAllocate(8 * kWordSize, HeapPage::kData,
+                                       PageSpace::kForceGrowth);
+  EXPECT(new_block != 0);
+  EXPECT_EQ(cached - 1, HeapPage::CachedPageCount());
+  delete space;
+}
+
 }  // namespace dart
@@ -367,8 +367,32 @@ void LookupCache::Insert(intptr_t receiver_cid,
   entries_[probe1].target = target;
 }
 
+void CallSiteCache::Clear() {
+  for (intptr_t i = 0; i < kNumEntries; i++) {
+    entries_[i].pc = nullptr;
+    entries_[i].receiver_cid = kIllegalCid;
+  }
+}
+
+void CallSiteCache::Insert(const KBCInstr* pc,
+                           intptr_t receiver_cid,
+                           RawFunction* target) {
+  // Like LookupCache, the entries are not visited by the GC and the cache is
+  // cleared whenever old space objects may move.
+  ASSERT(target->IsOldObject());
+  Entry& entry = entries_[Hash(pc)];
+  entry.pc = pc;
+  entry.receiver_cid = receiver_cid;
+  entry.target = target;
+}
+
 Interpreter::Interpreter()
-    : stack_(NULL), fp_(NULL), pp_(NULL), argdesc_(NULL), lookup_cache_() {
+    : stack_(NULL),
+      fp_(NULL),
+      pp_(NULL),
+      argdesc_(NULL),
+      lookup_cache_(),
+      call_site_cache_() {
   // Setup interpreter support first. Some of this information is needed to
   // setup the architecture state.
   // We allocate the stack here, the size is computed as the sum of
@@ -751,28 +775,39 @@ DART_FORCE_INLINE bool Interpreter::InstanceCall(Thread* thread,
       InterpreterHelpers::GetClassId(call_base[receiver_idx]);
 
   RawFunction* target;
-  if (UNLIKELY(!lookup_cache_.Lookup(receiver_cid, target_name, argdesc_,
-                                     &target))) {
-    // Table lookup miss.
-    top[0] = 0;  // Clean up slot as it may be visited by GC.
-    top[1] = call_base[receiver_idx];
-    top[2] = target_name;
-    top[3] = argdesc_;
-    top[4] = 0;  // Result slot.
-
-    Exit(thread, *FP, top + 5, *pc);
-    NativeArguments native_args(thread, 3, /* argv */ top + 1,
-                                /* result */ top + 4);
-    if (!InvokeRuntime(thread, this, DRT_InterpretedInstanceCallMissHandler,
-                       native_args)) {
-      return false;
-    }
+  if (UNLIKELY(!call_site_cache_.Lookup(*pc, receiver_cid, &target))) {
+    // Call site cache miss.
+    bool cacheable_at_call_site = true;
+    if (UNLIKELY(!lookup_cache_.Lookup(receiver_cid, target_name, argdesc_,
+                                       &target))) {
+      // Table lookup miss.
+      top[0] = 0;  // Clean up slot as it may be visited by GC.
+      top[1] = call_base[receiver_idx];
+      top[2] = target_name;
+      top[3] = argdesc_;
+      top[4] = 0;  // Result slot.
+
+      Exit(thread, *FP, top + 5, *pc);
+      NativeArguments native_args(thread, 3, /* argv */ top + 1,
+                                  /* result */ top + 4);
+      if (!InvokeRuntime(thread, this, DRT_InterpretedInstanceCallMissHandler,
+                         native_args)) {
+        return false;
+      }
 
-    target = static_cast<RawFunction*>(top[4]);
-    target_name = static_cast<RawString*>(top[2]);
-    argdesc_ = static_cast<RawArray*>(top[3]);
-    ASSERT(target->IsFunction());
-    lookup_cache_.Insert(receiver_cid, target_name, argdesc_, target);
+      target = static_cast<RawFunction*>(top[4]);
+      // The miss handler may redirect the call (e.g. to noSuchMethod) with a
+      // different selector or arguments descriptor. Such targets are only
+      // valid for the rewritten call, not for the call site itself.
+      cacheable_at_call_site = (target_name == top[2]) && (argdesc_ == top[3]);
+      target_name = static_cast<RawString*>(top[2]);
+      argdesc_ = static_cast<RawArray*>(top[3]);
+      ASSERT(target->IsFunction());
+      lookup_cache_.Insert(receiver_cid, target_name, argdesc_, target);
+    }
+    if (cacheable_at_call_site) {
+      call_site_cache_.Insert(*pc, receiver_cid, target);
+    }
   }
 
   top[0] = target;
@@ -820,6 +855,44 @@ DART_FORCE_INLINE bool Interpreter::InstanceCall(Thread* thread,
 // Load target of a jump instruction into PC.
 #define LOAD_JUMP_TARGET() pc = rT
 
+// Store the result of a comparison and dispatch. Comparisons are usually
+// followed by JumpIfTrue/JumpIfFalse, so such a pair is executed as one
+// superinstruction: branch on the result directly instead of pushing a Bool
+// and dispatching the jump separately. The comparison bytecode has already
+// dropped one operand and its result slot is SP[0]. Jump targets are decoded
+// as in BYTECODE_HEADER_T: an int8 offset for the 2 byte jumps and a 24-bit
+// offset for the 4 byte wide ones.
+#define DISPATCH_CONDITION(condition)                                          \
+  do {                                                                         \
+    const bool cond_value = (condition);                                       \
+    const KBCInstr next_op = *pc;                                              \
+    if ((next_op == KernelBytecode::kJumpIfTrue) ||                            \
+        (next_op == KernelBytecode::kJumpIfFalse)) {                           \
+      TRACE_INSTRUCTION                                                        \
+      SP -= 1;                                                                 \
+      if (cond_value == (next_op == KernelBytecode::kJumpIfTrue)) {            \
+        pc += static_cast<int8_t>(pc[1]);                                      \
+      } else {                                                                 \
+        pc += 2;                                                               \
+      }                                                                        \
+    } else if ((next_op == KernelBytecode::kJumpIfTrue_Wide) ||                \
+               (next_op == KernelBytecode::kJumpIfFalse_Wide)) {               \
+      TRACE_INSTRUCTION                                                        \
+      SP -= 1;                                                                 \
+      if (cond_value == (next_op == KernelBytecode::kJumpIfTrue_Wide)) {       \
+        pc += static_cast<int32_t>((static_cast<uint32_t>(pc[1]) << 8) |       \
+                                   (static_cast<uint32_t>(pc[2]) << 16) |      \
+                                   (static_cast<uint32_t>(pc[3]) << 24)) >>    \
+              8;                                                               \
+      } else {                                                                 \
+        pc += 4;                                                               \
+      }                                                                        \
+    } else {                                                                   \
+      SP[0] = cond_value ? true_value : false_value;                           \
+    }                                                                          \
+    DISPATCH();                                                                \
+  } while (0)
+
 #define BYTECODE_ENTRY_LABEL(Name) bc##Name:
 #define BYTECODE_WIDE_ENTRY_LABEL(Name) bc##Name##_Wide:
 #define BYTECODE_IMPL_LABEL(Name) bc##Name##Impl:
@@ -2986,8 +3059,7 @@ SwitchDispatch:
     SP -= 1;
     UNBOX_INT64(a, SP[0], Symbols::RAngleBracket());
     UNBOX_INT64(b, SP[1], Symbols::RAngleBracket());
-    SP[0] = (a > b) ? true_value : false_value;
-    DISPATCH();
+    DISPATCH_CONDITION(a > b);
   }
 
   {
@@ -2996,8 +3068,7 @@ SwitchDispatch:
     SP -= 1;
     UNBOX_INT64(a, SP[0], Symbols::LAngleBracket());
     UNBOX_INT64(b, SP[1], Symbols::LAngleBracket());
-    SP[0] = (a < b) ? true_value : false_value;
-    DISPATCH();
+    DISPATCH_CONDITION(a < b);
   }
 
   {
@@ -3006,8 +3077,7 @@ SwitchDispatch:
     SP -= 1;
     UNBOX_INT64(a, SP[0], Symbols::GreaterEqualOperator());
     UNBOX_INT64(b, SP[1], Symbols::GreaterEqualOperator());
-    SP[0] = (a >= b) ? true_value : false_value;
-    DISPATCH();
+    DISPATCH_CONDITION(a >= b);
   }
 
   {
@@ -3016,8 +3086,7 @@ SwitchDispatch:
     SP -= 1;
     UNBOX_INT64(a, SP[0], Symbols::LessEqualOperator());
     UNBOX_INT64(b, SP[1], Symbols::LessEqualOperator());
-    SP[0] = (a <= b) ? true_value : false_value;
-    DISPATCH();
+    DISPATCH_CONDITION(a <= b);
   }
 
   {
@@ -3093,8 +3162,7 @@ SwitchDispatch:
     SP -= 1;
     UNBOX_DOUBLE(a, SP[0], Symbols::RAngleBracket());
     UNBOX_DOUBLE(b, SP[1], Symbols::RAngleBracket());
-    SP[0] = (a > b) ? true_value : false_value;
-    DISPATCH();
+    DISPATCH_CONDITION(a > b);
   }
 
   {
@@ -3103,8 +3171,7 @@ SwitchDispatch:
     SP -= 1;
     UNBOX_DOUBLE(a, SP[0], Symbols::LAngleBracket());
     UNBOX_DOUBLE(b, SP[1], Symbols::LAngleBracket());
-    SP[0] = (a < b) ? true_value : false_value;
-    DISPATCH();
+    DISPATCH_CONDITION(a < b);
   }
 
   {
@@ -3113,8 +3180,7 @@ SwitchDispatch:
     SP -= 1;
     UNBOX_DOUBLE(a, SP[0], Symbols::GreaterEqualOperator());
     UNBOX_DOUBLE(b, SP[1], Symbols::GreaterEqualOperator());
-    SP[0] = (a >= b) ? true_value : false_value;
-    DISPATCH();
+    DISPATCH_CONDITION(a >= b);
   }
 
   {
@@ -3123,8 +3189,7 @@ SwitchDispatch:
     SP -= 1;
     UNBOX_DOUBLE(a, SP[0], Symbols::LessEqualOperator());
     UNBOX_DOUBLE(b, SP[1], Symbols::LessEqualOperator());
-    SP[0] = (a <= b) ? true_value : false_value;
-    DISPATCH();
+    DISPATCH_CONDITION(a <= b);
   }
 
   {
@@ -63,6 +63,49 @@ class LookupCache : public ValueObject {
   Entry entries_[kNumEntries];
 };
 
+// Monomorphic inline cache of instance call sites, keyed by the address of the
+// call bytecode. It is probed before the LookupCache, so a call site that
+// keeps seeing the same receiver class is resolved with a single comparison
+// of (pc, cid), without hashing the selector and arguments descriptor.
+class CallSiteCache : public ValueObject {
+ public:
+  CallSiteCache() {
+    ASSERT(Utils::IsPowerOfTwo(kNumEntries));
+    Clear();
+  }
+
+  void Clear();
+
+  bool Lookup(const KBCInstr* pc,
+              intptr_t receiver_cid,
+              RawFunction** target) const {
+    const Entry& entry = entries_[Hash(pc)];
+    if ((entry.pc == pc) && (entry.receiver_cid == receiver_cid)) {
+      *target = entry.target;
+      return true;
+    }
+    return false;
+  }
+
+  void Insert(const KBCInstr* pc, intptr_t receiver_cid, RawFunction* target);
+
+ private:
+  struct Entry {
+    const KBCInstr* pc;
+    intptr_t receiver_cid;
+    RawFunction* target;
+  };
+
+  static intptr_t Hash(const KBCInstr* pc) {
+    return reinterpret_cast<uword>(pc) & kTableMask;
+  }
+
+  static const intptr_t kNumEntries = 1024;
+  static const intptr_t kTableMask = kNumEntries - 1;
+
+  Entry entries_[kNumEntries];
+};
+
 // Interpreter intrinsic handler. It is invoked on entry to the intrinsified
 // function via Intrinsic bytecode before the frame is setup.
 // If the handler returns true then Intrinsic bytecode works as a return
@@ -124,7 +167,10 @@ class Interpreter {
   void Unexit(Thread* thread);
 
   void VisitObjectPointers(ObjectPointerVisitor* visitor);
-  void ClearLookupCache() { lookup_cache_.Clear(); }
+  void ClearLookupCache() {
+    lookup_cache_.Clear();
+    call_site_cache_.Clear();
+  }
 
 #ifndef PRODUCT
   void set_is_debugging(bool value) { is_debugging_ = value; }
@@ -149,6 +195,7 @@ class Interpreter {
   RawObject* special_[KernelBytecode::kSpecialIndexCount];
 
   LookupCache lookup_cache_;
+  CallSiteCache call_site_cache_;
 
   void Exit(Thread* thread,
             RawObject** base,
@@ -203,6 +203,8 @@ IsolateGroup::IsolateGroup(std::unique_ptr<IsolateGroupSource> source,
 #if !defined(PRODUCT) && !defined(DART_PRECOMPILED_RUNTIME)
       last_reload_timestamp_(OS::GetCurrentTimeMillis()),
 #endif
+      prespawned_isolates_mutex_(new Mutex()),
+      prespawned_isolates_(),
       source_(std::move(source)),
       thread_registry_(new ThreadRegistry()),
       safepoint_handler_(new SafepointHandler(this)) {
@@ -216,13 +218,49 @@ void IsolateGroup::RegisterIsolate(Isolate* isolate) {
   isolate_count_++;
 }
 
+class ShutdownPrespawnedIsolatesTask : public ThreadPool::Task {
+ public:
+  explicit ShutdownPrespawnedIsolatesTask(
+      MallocGrowableArray<Isolate*>* isolates)
+      : isolates_() {
+    isolates_.AddArray(*isolates);
+  }
+
+  void Run() override {
+    IsolateGroup::ShutdownPrespawnedIsolates(&isolates_);
+  }
+
+ private:
+  MallocGrowableArray<Isolate*> isolates_;
+
+  DISALLOW_COPY_AND_ASSIGN(ShutdownPrespawnedIsolatesTask);
+};
+
 void IsolateGroup::UnregisterIsolate(Isolate* isolate) {
   bool is_last_isolate = false;
+  MallocGrowableArray<Isolate*> unused_isolates;
   {
     WriteRwLocker wl(ThreadState::Current(), isolates_rwlock_.get());
     isolates_.Remove(isolate);
     isolate_count_--;
     is_last_isolate = isolate_count_ == 0;
+    if (!is_last_isolate) {
+      // Pooled isolates are only ever handed out to isolates spawned from a
+      // live isolate of this group. Once only pooled isolates remain, shut
+      // them down so the group can go away. The pool itself stays open: a
+      // refill is always started by a live isolate, so an isolate created
+      // within the group afterwards can populate it again.
+      MutexLocker ml(prespawned_isolates_mutex_.get());
+      if (isolate_count_ == prespawned_isolates_.length()) {
+        TakeAllPrespawnedIsolatesLocked(&unused_isolates);
+      }
+    }
+  }
+  if (!unused_isolates.is_empty()) {
+    // The isolates cannot be shut down on this thread, which is still in the
+    // middle of shutting down [isolate].
+    Dart::thread_pool()->Run<ShutdownPrespawnedIsolatesTask>(
+        &unused_isolates);
   }
   if (is_last_isolate) {
     // If the creation of the isolate group (or the first isolate within the
@@ -457,6 +495,73 @@ void IsolateGroup::RunWithIsolateGroup(
   not_found();
 }
 
+Isolate* IsolateGroup::TakePrespawnedIsolate() {
+  MutexLocker ml(prespawned_isolates_mutex_.get());
+  if (prespawned_isolates_.is_empty()) {
+    return nullptr;
+  }
+  return prespawned_isolates_.RemoveLast();
+}
+
+bool IsolateGroup::AddPrespawnedIsolate(Isolate* isolate, intptr_t max_size) {
+  MutexLocker ml(prespawned_isolates_mutex_.get());
+  if (prespawned_isolates_shut_down_ ||
+      (prespawned_isolates_.length() >= max_size)) {
+    return false;
+  }
+  prespawned_isolates_.Add(isolate);
+  return true;
+}
+
+intptr_t IsolateGroup::PrespawnedIsolateCount() {
+  MutexLocker ml(prespawned_isolates_mutex_.get());
+  return prespawned_isolates_.length();
+}
+
+bool IsolateGroup::StartPrespawnedIsolatesRefill(intptr_t max_size) {
+  MutexLocker ml(prespawned_isolates_mutex_.get());
+  if (prespawned_isolates_shut_down_ || prespawned_isolates_refilling_ ||
+      (prespawned_isolates_.length() >= max_size)) {
+    return false;
+  }
+  prespawned_isolates_refilling_ = true;
+  return true;
+}
+
+void IsolateGroup::FinishPrespawnedIsolatesRefill() {
+  MutexLocker ml(prespawned_isolates_mutex_.get());
+  ASSERT(prespawned_isolates_refilling_);
+  prespawned_isolates_refilling_ = false;
+}
+
+void IsolateGroup::TakeAllPrespawnedIsolatesLocked(
+    MallocGrowableArray<Isolate*>* isolates) {
+  ASSERT(prespawned_isolates_mutex_->IsOwnedByCurrentThread());
+  isolates->AddArray(prespawned_isolates_);
+  prespawned_isolates_.Clear();
+}
+
+void IsolateGroup::ShutdownPrespawnedIsolates(
+    MallocGrowableArray<Isolate*>* isolates) {
+  for (intptr_t i = 0; i < isolates->length(); i++) {
+    Dart_EnterIsolate(Api::CastIsolate(isolates->At(i)));
+    Dart_ShutdownIsolate();
+  }
+  isolates->Clear();
+}
+
+void IsolateGroup::ShutdownAllPrespawnedIsolates() {
+  MallocGrowableArray<Isolate*> isolates;
+  ForEach([&](IsolateGroup* group) {
+    MutexLocker ml(group->prespawned_isolates_mutex_.get());
+    group->prespawned_isolates_shut_down_ = true;
+    group->TakeAllPrespawnedIsolatesLocked(&isolates);
+  });
+  // Shutting down the last isolate of a group deletes the group, so this has
+  // to happen outside of [ForEach].
+  ShutdownPrespawnedIsolates(&isolates);
+}
+
 void IsolateGroup::RegisterIsolateGroup(IsolateGroup* isolate_group) {
   WriteRwLocker wl(ThreadState::Current(), isolate_groups_rwlock_);
   isolate_groups_->Append(isolate_group);
@@ -367,6 +367,29 @@ class IsolateGroup : public IntrusiveDListEntry<IsolateGroup> {
 
   uint64_t id() { return id_; }
 
+  // Pool of isolates which have been created and initialized ahead of time
+  // within this isolate group, so that Isolate.spawn only has to hand the
+  // entry message to one of them (see --isolate_spawn_pool_size).
+  //
+  // Returns nullptr if the pool is empty.
+  Isolate* TakePrespawnedIsolate();
+
+  // Returns false if the pool already holds [max_size] isolates or has been
+  // shut down by Dart::Cleanup. The caller remains responsible for shutting
+  // down [isolate] in that case.
+  bool AddPrespawnedIsolate(Isolate* isolate, intptr_t max_size);
+
+  intptr_t PrespawnedIsolateCount();
+
+  // Returns true if the caller should refill the pool up to [max_size]
+  // isolates, in which case it has to call [FinishPrespawnedIsolatesRefill]
+  // once done. At most one refill is in progress at any time.
+  bool StartPrespawnedIsolatesRefill(intptr_t max_size);
+  void FinishPrespawnedIsolatesRefill();
+
+  // Closes the pools of all isolate groups and shuts the pooled isolates down.
+  static void ShutdownAllPrespawnedIsolates();
+
   static void Init();
   static void Cleanup();
 
@@ -393,6 +416,15 @@ class IsolateGroup : public IntrusiveDListEntry<IsolateGroup> {
   std::shared_ptr<IsolateGroupReloadContext> group_reload_context_;
 #endif
 
+  void TakeAllPrespawnedIsolatesLocked(MallocGrowableArray<Isolate*>* isolates);
+  static void ShutdownPrespawnedIsolates(
+      MallocGrowableArray<Isolate*>* isolates);
+
+  std::unique_ptr<Mutex> prespawned_isolates_mutex_;
+  MallocGrowableArray<Isolate*> prespawned_isolates_;
+  bool prespawned_isolates_refilling_ = false;
+  bool prespawned_isolates_shut_down_ = false;
+
   std::unique_ptr<IsolateGroupSource> source_;
   std::unique_ptr<ThreadRegistry> thread_registry_;
   std::unique_ptr<SafepointHandler> safepoint_handler_;
@@ -402,6 +434,8 @@ class IsolateGroup : public IntrusiveDListEntry<IsolateGroup> {
 
   Random isolate_group_random_;
   uint64_t id_ = isolate_group_random_.NextUInt64();
+
+  friend class ShutdownPrespawnedIsolatesTask;
 };
 
 class Isolate : public BaseIsolate, public IntrusiveDListEntry<Isolate> {
@@ -16097,8 +16097,20 @@ void SubtypeTestCache::set_cache(const Array& value) const {
 
 intptr_t SubtypeTestCache::NumberOfChecks() const {
   NoSafepointScope no_safepoint;
-  // Do not count the sentinel;
-  return (Smi::Value(cache()->ptr()->length_) / kTestEntryLength) - 1;
+  // The backing array may have spare capacity after the checks, so count the
+  // entries up to the first unused one. Unused entries (including the
+  // sentinel) have a null instance class id or function.
+  RawArray* data = cache();
+  const intptr_t length = Smi::Value(data->ptr()->length_);
+  intptr_t count = 0;
+  for (intptr_t i = kInstanceClassIdOrFunction; i < length;
+       i += kTestEntryLength) {
+    if (data->ptr()->data()[i] == Object::null()) {
+      break;
+    }
+    count++;
+  }
+  return count;
 }
 
 void SubtypeTestCache::AddCheck(
@@ -16111,9 +16123,15 @@ void SubtypeTestCache::AddCheck(
     const Bool& test_result) const {
   intptr_t old_num = NumberOfChecks();
   Array& data = Array::Handle(cache());
-  intptr_t new_len = data.Length() + kTestEntryLength;
-  data = Array::Grow(data, new_len);
-  set_cache(data);
+  // Keep room for the new check and the null sentinel which terminates the
+  // linear search in the stubs. Grow geometrically so that filling a cache
+  // with n checks does not copy the array n times.
+  const intptr_t needed_len = (old_num + 2) * kTestEntryLength;
+  if (data.Length() < needed_len) {
+    const intptr_t new_len = Utils::Maximum(needed_len, 2 * data.Length());
+    data = Array::Grow(data, new_len, Heap::kOld);
+    set_cache(data);
+  }
 
   SubtypeTestCacheTable entries(data);
   auto entry = entries[old_num];
@@ -19787,6 +19805,17 @@ bool String::Equals(const String& str,
     return false;  // Lengths don't match.
   }
 
+  NoSafepointScope no_safepoint;
+  const uint8_t* latin1 = Latin1Data(*this);
+  const uint8_t* str_latin1 = Latin1Data(str);
+  if ((latin1 != NULL) && (str_latin1 != NULL)) {
+    return memcmp(latin1, str_latin1 + begin_index, len) == 0;
+  }
+  const uint16_t* utf16 = Utf16Data(*this);
+  const uint16_t* str_utf16 = Utf16Data(str);
+  if ((utf16 != NULL) && (str_utf16 != NULL)) {
+    return memcmp(utf16, str_utf16 + begin_index, len * sizeof(uint16_t)) == 0;
+  }
   for (intptr_t i = 0; i < len; i++) {
     if (CharAt(i) != str.CharAt(begin_index + i)) {
       return false;
@@ -19823,6 +19852,11 @@ bool String::Equals(const uint8_t* latin1_array, intptr_t len) const {
     return false;
   }
 
+  NoSafepointScope no_safepoint;
+  const uint8_t* latin1 = Latin1Data(*this);
+  if (latin1 != NULL) {
+    return memcmp(latin1, latin1_array, len) == 0;
+  }
   for (intptr_t i = 0; i < len; i++) {
     if (this->CharAt(i) != latin1_array[i]) {
       return false;
@@ -19837,6 +19871,11 @@ bool String::Equals(const uint16_t* utf16_array, intptr_t len) const {
     return false;
   }
 
+  NoSafepointScope no_safepoint;
+  const uint16_t* utf16 = Utf16Data(*this);
+  if (utf16 != NULL) {
+    return memcmp(utf16, utf16_array, len * sizeof(uint16_t)) == 0;
+  }
   for (intptr_t i = 0; i < len; i++) {
     if (this->CharAt(i) != utf16_array[i]) {
       return false;
@@ -19873,6 +19912,19 @@ intptr_t String::CompareTo(const String& other) const {
   const intptr_t this_len = this->Length();
   const intptr_t other_len = other.IsNull() ? 0 : other.Length();
   const intptr_t len = (this_len < other_len) ? this_len : other_len;
+  if (len > 0) {
+    NoSafepointScope no_safepoint;
+    const uint8_t* latin1 = Latin1Data(*this);
+    const uint8_t* other_latin1 = Latin1Data(other);
+    if ((latin1 != NULL) && (other_latin1 != NULL)) {
+      // Bytes compare as unsigned, which is the code unit order.
+      const int result = memcmp(latin1, other_latin1, len);
+      if (result != 0) {
+        return (result < 0) ? -1 : 1;
+      }
+      return (this_len < other_len) ? -1 : ((this_len > other_len) ? 1 : 0);
+    }
+  }
   for (intptr_t i = 0; i < len; i++) {
     uint16_t this_code_unit = this->CharAt(i);
     uint16_t other_code_unit = other.CharAt(i);
@@ -19920,6 +19972,73 @@ bool String::EndsWith(const String& other) const {
   return true;
 }
 
+intptr_t String::IndexOf(uint16_t code_unit, intptr_t start) const {
+  const intptr_t len = Length();
+  ASSERT((start >= 0) && (start <= len));
+  NoSafepointScope no_safepoint;
+  const uint8_t* latin1 = Latin1Data(*this);
+  if (latin1 != NULL) {
+    if ((code_unit > 0xFF) || (start == len)) {
+      return -1;
+    }
+    // memchr is vectorized by the C library.
+    const void* found = memchr(latin1 + start, code_unit, len - start);
+    return (found == NULL) ? -1
+                           : (reinterpret_cast<const uint8_t*>(found) - latin1);
+  }
+  const uint16_t* utf16 = Utf16Data(*this);
+  ASSERT(utf16 != NULL);
+  for (intptr_t i = start; i < len; i++) {
+    if (utf16[i] == code_unit) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+intptr_t String::IndexOf(const String& other, intptr_t start) const {
+  const intptr_t len = Length();
+  const intptr_t other_len = other.Length();
+  ASSERT((start >= 0) && (start <= len));
+  if (other_len == 0) {
+    return start;
+  }
+  const intptr_t last = len - other_len;
+  const uint16_t first = other.CharAt(0);
+  for (intptr_t i = start; i <= last; i++) {
+    // Skip to the next occurrence of the first code unit, then compare the
+    // rest.
+    i = IndexOf(first, i);
+    if ((i < 0) || (i > last)) {
+      return -1;
+    }
+    if (other.Equals(*this, i, other_len)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+const uint8_t* String::Latin1Data(const String& str) {
+  if (str.IsOneByteString()) {
+    return OneByteString::DataStart(str);
+  }
+  if (str.IsExternalOneByteString()) {
+    return ExternalOneByteString::DataStart(str);
+  }
+  return NULL;
+}
+
+const uint16_t* String::Utf16Data(const String& str) {
+  if (str.IsTwoByteString()) {
+    return TwoByteString::DataStart(str);
+  }
+  if (str.IsExternalTwoByteString()) {
+    return ExternalTwoByteString::DataStart(str);
+  }
+  return NULL;
+}
+
 RawInstance* String::CheckAndCanonicalize(Thread* thread,
                                           const char** error_str) const {
   if (IsCanonical()) {
@@ -20063,8 +20182,12 @@ void String::Copy(const String& dst,
       memmove(OneByteString::CharAddr(dst, dst_offset), characters, len);
     }
   } else if (dst.IsTwoByteString()) {
-    for (intptr_t i = 0; i < len; ++i) {
-      *TwoByteString::CharAddr(dst, i + dst_offset) = characters[i];
+    NoSafepointScope no_safepoint;
+    if (len > 0) {
+      uint16_t* dst_chars = TwoByteString::CharAddr(dst, dst_offset);
+      for (intptr_t i = 0; i < len; ++i) {
+        dst_chars[i] = characters[i];
+      }
     }
   }
 }
@@ -20078,9 +20201,12 @@ void String::Copy(const String& dst,
   ASSERT(array_len <= (dst.Length() - dst_offset));
   if (dst.IsOneByteString()) {
     NoSafepointScope no_safepoint;
-    for (intptr_t i = 0; i < array_len; ++i) {
-      ASSERT(Utf::IsLatin1(utf16_array[i]));
-      *OneByteString::CharAddr(dst, i + dst_offset) = utf16_array[i];
+    if (array_len > 0) {
+      uint8_t* dst_chars = OneByteString::CharAddr(dst, dst_offset);
+      for (intptr_t i = 0; i < array_len; ++i) {
+        ASSERT(Utf::IsLatin1(utf16_array[i]));
+        dst_chars[i] = utf16_array[i];
+      }
     }
   } else {
     ASSERT(dst.IsTwoByteString());
@@ -22558,6 +22684,15 @@ void RegExp::set_capture_name_map(const Array& array) const {
   StorePointer(&raw_ptr()->capture_name_map_, array.raw());
 }
 
+void RegExp::set_literal_prefix(const String& prefix) const {
+  StorePointer(&raw_ptr()->literal_prefix_, prefix.raw());
+}
+
+void RegExp::set_linear_program(const Object& program) const {
+  ASSERT(program.IsTypedData() || (program.raw() == Bool::False().raw()));
+  StorePointer(&raw_ptr()->linear_program_, program.raw());
+}
+
 RawRegExp* RegExp::New(Heap::Space space) {
   RegExp& result = RegExp::Handle();
   {
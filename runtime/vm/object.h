@@ -7915,6 +7915,11 @@ class String : public Instance {
   bool StartsWith(const String& other) const;
   bool EndsWith(const String& other) const;
 
+  // Returns the index of the first occurrence of [other] at or after
+  // [start], or -1 if there is none.
+  intptr_t IndexOf(const String& other, intptr_t start) const;
+  intptr_t IndexOf(uint16_t code_unit, intptr_t start) const;
+
   // Strings are canonicalized using the symbol table.
   virtual RawInstance* CheckAndCanonicalize(Thread* thread,
                                             const char** error_str) const;
@@ -8098,6 +8103,11 @@ class String : public Instance {
 
   void SetHash(intptr_t value) const { SetCachedHash(raw(), value); }
 
+  // The code units of a one-byte or a two-byte string, internal or external,
+  // or NULL if [str] has the other width. Only valid until the next safepoint.
+  static const uint8_t* Latin1Data(const String& str);
+  static const uint16_t* Utf16Data(const String& str);
+
   template <typename HandleType, typename ElementType, typename CallbackType>
   static void ReadFromImpl(SnapshotReader* reader,
                            String* str_obj,
@@ -9954,6 +9964,17 @@ class RegExp : public Instance {
   }
   RawArray* capture_name_map() const { return raw_ptr()->capture_name_map_; }
 
+  // The code units every match starts with, which the bytecode interpreter
+  // scans for before matching. Empty if there are none and null until the
+  // pattern is compiled to bytecode.
+  RawString* literal_prefix() const { return raw_ptr()->literal_prefix_; }
+
+  // The LinearRegExp program the bytecode interpreter falls back to when a
+  // match backtracks too much. Null until a match first needs it, and
+  // Bool::False() if LinearRegExp does not support the pattern. The program
+  // does not depend on the subject's width or on stickiness.
+  RawObject* linear_program() const { return raw_ptr()->linear_program_; }
+
   RawTypedData* bytecode(bool is_one_byte, bool sticky) const {
     if (sticky) {
       return is_one_byte ? raw_ptr()->one_byte_sticky_.bytecode_
@@ -10010,6 +10031,8 @@ class RegExp : public Instance {
 
   void set_num_bracket_expressions(intptr_t value) const;
   void set_capture_name_map(const Array& array) const;
+  void set_literal_prefix(const String& prefix) const;
+  void set_linear_program(const Object& program) const;
   void set_is_global() const {
     RegExpFlags f = flags();
     f.SetGlobal();
@@ -343,6 +343,26 @@ ISOLATE_UNIT_TEST_CASE(StringCompareTo) {
   EXPECT(monkey_face.CompareTo(abce) > 0);
 }
 
+ISOLATE_UNIT_TEST_CASE(StringIndexOf) {
+  const String& haystack = String::Handle(String::New("abcabdabe\xc3\xa9"));
+  EXPECT_EQ(0, haystack.IndexOf(String::Handle(String::New("abc")), 0));
+  EXPECT_EQ(3, haystack.IndexOf(String::Handle(String::New("abd")), 1));
+  EXPECT_EQ(6, haystack.IndexOf(String::Handle(String::New("ab")), 4));
+  EXPECT_EQ(-1, haystack.IndexOf(String::Handle(String::New("abf")), 0));
+  EXPECT_EQ(9, haystack.IndexOf(String::Handle(String::New("\xc3\xa9")), 0));
+  EXPECT_EQ(5, haystack.IndexOf(Symbols::Empty(), 5));
+  EXPECT_EQ(-1, haystack.IndexOf(0x100, 0));
+  EXPECT_EQ(8, haystack.IndexOf('e', 0));
+  EXPECT_EQ(-1, haystack.IndexOf('a', 7));
+
+  const uint16_t chars[] = {'x', 0x3b1, 'y', 0x3b1, 'z'};
+  const String& two_byte = String::Handle(String::FromUTF16(chars, 5));
+  EXPECT_EQ(3, two_byte.IndexOf(0x3b1, 2));
+  EXPECT_EQ(3, two_byte.IndexOf(String::Handle(String::FromUTF16(&chars[3], 2)),
+                                0));
+  EXPECT_EQ(-1, two_byte.IndexOf(String::Handle(String::New("yz")), 0));
+}
+
 ISOLATE_UNIT_TEST_CASE(StringEncodeIRI) {
   const char* kInput =
       "file:///usr/local/johnmccutchan/workspace/dart-repo/dart/test.dart";
@@ -542,6 +562,44 @@ ISOLATE_UNIT_TEST_CASE(Double) {
   }
 }
 
+static void ExpectParsedDouble(const char* literal, double expected) {
+  const String& str = String::Handle(String::New(literal));
+  double value = 0.0;
+  EXPECT(String::ParseDouble(str, 0, str.Length(), &value));
+  EXPECT_EQ(bit_cast<uint64_t>(expected), bit_cast<uint64_t>(value));
+}
+
+ISOLATE_UNIT_TEST_CASE(DoubleParse) {
+  ExpectParsedDouble("0", 0.0);
+  ExpectParsedDouble("-0.0", -0.0);
+  ExpectParsedDouble("123.456", 123.456);
+  ExpectParsedDouble("1e23", 1e23);
+  ExpectParsedDouble("0.000001", 0.000001);
+  ExpectParsedDouble("9007199254740993", 9007199254740992.0);
+  ExpectParsedDouble("9007199254740995", 9007199254740996.0);
+  ExpectParsedDouble("2.2250738585072011e-308", 2.2250738585072011e-308);
+  ExpectParsedDouble("4.9406564584124654e-324", 5e-324);
+  ExpectParsedDouble("2.4703282292062327e-324", 0.0);
+  ExpectParsedDouble("2.4703282292062328e-324", 5e-324);
+  ExpectParsedDouble("1.7976931348623157e308", 1.7976931348623157e308);
+  ExpectParsedDouble("1.7976931348623159e308", INFINITY);
+  ExpectParsedDouble("1e-400", 0.0);
+  ExpectParsedDouble("-1E+400", -INFINITY);
+  // Too many digits for the fast path.
+  ExpectParsedDouble("3.14159265358979323846264338327950288",
+                     3.141592653589793);
+  ExpectParsedDouble("+1.5", 1.5);
+  ExpectParsedDouble(".5", 0.5);
+  ExpectParsedDouble("Infinity", INFINITY);
+
+  const char* kInvalid[] = {"-", "1e", "1.5x", "0x10", "1e+", "--1"};
+  for (intptr_t i = 0; i < ARRAY_SIZE(kInvalid); i++) {
+    const String& str = String::Handle(String::New(kInvalid[i]));
+    double value;
+    EXPECT(!String::ParseDouble(str, 0, str.Length(), &value));
+  }
+}
+
 ISOLATE_UNIT_TEST_CASE(Integer) {
   Integer& i = Integer::Handle();
   i = Integer::NewCanonical(String::Handle(String::New("12")));
@@ -3003,6 +3061,27 @@ ISOLATE_UNIT_TEST_CASE(SubtypeTestCache) {
   EXPECT_EQ(targ_1.raw(), test_targ_1.raw());
   EXPECT_EQ(targ_2.raw(), test_targ_2.raw());
   EXPECT_EQ(Bool::True().raw(), test_result.raw());
+
+  // The backing array grows with spare capacity; the number of checks must
+  // not include the unused entries and the last entry must stay a sentinel.
+  Object& other_class_id = Object::Handle();
+  for (intptr_t i = 1; i < 20; i++) {
+    other_class_id = Smi::New(empty_class.id() + i);
+    cache.AddCheck(other_class_id, targ_0, targ_1, targ_2, targ_3, targ_4,
+                   Bool::False());
+    EXPECT_EQ(i + 1, cache.NumberOfChecks());
+  }
+  const Array& entries = Array::Handle(cache.cache());
+  EXPECT(entries.Length() >=
+         (cache.NumberOfChecks() + 1) * SubtypeTestCache::kTestEntryLength);
+  EXPECT(entries.At(cache.NumberOfChecks() *
+                        SubtypeTestCache::kTestEntryLength +
+                    SubtypeTestCache::kInstanceClassIdOrFunction) ==
+         Object::null());
+  cache.GetCheck(19, &test_class_id_or_fun, &test_targ_0, &test_targ_1,
+                 &test_targ_2, &test_targ_3, &test_targ_4, &test_result);
+  EXPECT_EQ(Smi::New(empty_class.id() + 19), test_class_id_or_fun.raw());
+  EXPECT_EQ(Bool::False().raw(), test_result.raw());
 }
 
 ISOLATE_UNIT_TEST_CASE(FieldTests) {
@@ -2657,6 +2657,8 @@ class RawRegExp : public RawInstance {
   RawSmi* num_bracket_expressions_;
   RawArray* capture_name_map_;
   RawString* pattern_;  // Pattern to be used for matching.
+  RawString* literal_prefix_;  // Code units every match starts with.
+  RawObject* linear_program_;  // Null, a LinearRegExp program or false.
   union {
     RawFunction* function_;
     RawTypedData* bytecode_;
@@ -183,6 +183,8 @@ namespace dart {
   F(RegExp, num_bracket_expressions_)                                          \
   F(RegExp, capture_name_map_)                                                 \
   F(RegExp, pattern_)                                                          \
+  F(RegExp, literal_prefix_)                                                   \
+  F(RegExp, linear_program_)                                                   \
   F(RegExp, external_one_byte_function_)                                       \
   F(RegExp, external_two_byte_function_)                                       \
   F(RegExp, external_one_byte_sticky_function_)                                \
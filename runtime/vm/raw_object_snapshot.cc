@@ -686,7 +686,8 @@ RawInstance* Instance::ReadFrom(SnapshotReader* reader,
   // Create an Instance object or get canonical one if it is a canonical
   // constant.
   Instance& obj = Instance::ZoneHandle(reader->zone(), Instance::null());
-  obj ^= Object::Allocate(kInstanceCid, Instance::InstanceSize(), Heap::kNew);
+  obj ^= Object::Allocate(kInstanceCid, Instance::InstanceSize(),
+                          reader->space());
   if (RawObject::IsCanonical(tags)) {
     const char* error_str = NULL;
     obj = obj.CheckAndCanonicalize(reader->thread(), &error_str);
@@ -743,7 +744,7 @@ RawInteger* Mint::ReadFrom(SnapshotReader* reader,
     mint = Mint::NewCanonical(value);
     ASSERT(mint.IsCanonical());
   } else {
-    mint = Mint::New(value);
+    mint = Mint::New(value, reader->space());
   }
   reader->AddBackRef(object_id, &mint, kIsDeserialized);
   return mint.raw();
@@ -827,13 +828,18 @@ void String::ReadFromImpl(SnapshotReader* reader,
     *str_obj = (*new_symbol)(reader->thread(), ptr, len);
   } else {
     // Set up the string object.
-    *str_obj = StringType::New(len, Heap::kNew);
+    *str_obj = StringType::New(len, reader->space());
     str_obj->SetHash(0);  // Will get computed when needed.
     if (len == 0) {
       return;
     }
     NoSafepointScope no_safepoint;
     CharacterType* str_addr = StringType::DataStart(*str_obj);
+    if (sizeof(CharacterType) == 1) {
+      // One byte strings are written with WriteBytes, copy them in bulk.
+      reader->ReadBytes(reinterpret_cast<uint8_t*>(str_addr), len);
+      return;
+    }
     for (intptr_t i = 0; i < len; i++) {
       *str_addr = reader->Read<CharacterType>();
       str_addr++;
@@ -980,7 +986,8 @@ RawArray* Array::ReadFrom(SnapshotReader* reader,
     state = kIsNotDeserialized;
   }
   if (array == NULL) {
-    array = &(Array::ZoneHandle(reader->zone(), Array::New(len)));
+    array =
+        &(Array::ZoneHandle(reader->zone(), Array::New(len, reader->space())));
     reader->AddBackRef(object_id, array, state);
   }
   if (!as_reference) {
@@ -1009,7 +1016,8 @@ RawImmutableArray* ImmutableArray::ReadFrom(SnapshotReader* reader,
     state = kIsNotDeserialized;
   }
   if (array == NULL) {
-    array = &(Array::ZoneHandle(reader->zone(), ImmutableArray::New(len)));
+    array = &(Array::ZoneHandle(reader->zone(),
+                                 ImmutableArray::New(len, reader->space())));
     reader->AddBackRef(object_id, array, state);
   }
   if (!as_reference) {
@@ -1055,7 +1063,7 @@ RawGrowableObjectArray* GrowableObjectArray::ReadFrom(SnapshotReader* reader,
   // Read the length so that we can determine instance size to allocate.
   GrowableObjectArray& array = GrowableObjectArray::ZoneHandle(
       reader->zone(), GrowableObjectArray::null());
-  array = GrowableObjectArray::New(0);
+  array = GrowableObjectArray::New(0, reader->space());
   reader->AddBackRef(object_id, &array, kIsDeserialized);
 
   // Read type arguments of growable array object.
@@ -1106,7 +1114,7 @@ RawLinkedHashMap* LinkedHashMap::ReadFrom(SnapshotReader* reader,
   LinkedHashMap& map =
       LinkedHashMap::ZoneHandle(reader->zone(), LinkedHashMap::null());
   // Since the map might contain itself as a key or value, allocate first.
-  map = LinkedHashMap::NewUninitialized();
+  map = LinkedHashMap::NewUninitialized(reader->space());
   reader->AddBackRef(object_id, &map, kIsDeserialized);
 
   // Read the type arguments.
@@ -1122,7 +1130,8 @@ RawLinkedHashMap* LinkedHashMap::ReadFrom(SnapshotReader* reader,
   intptr_t data_size =
       Utils::Maximum(Utils::RoundUpToPowerOfTwo(used_data),
                      static_cast<uintptr_t>(LinkedHashMap::kInitialIndexSize));
-  Array& data = Array::ZoneHandle(reader->zone(), Array::New(data_size));
+  Array& data = Array::ZoneHandle(reader->zone(),
+                                  Array::New(data_size, reader->space()));
   map.SetData(data);
   map.SetDeletedKeys(0);
 
@@ -1313,7 +1322,8 @@ RawTypedData* TypedData::ReadFrom(SnapshotReader* reader,
   intptr_t cid = RawObject::ClassIdTag::decode(tags);
   intptr_t len = reader->ReadSmiValue();
   TypedData& result =
-      TypedData::ZoneHandle(reader->zone(), TypedData::New(cid, len));
+      TypedData::ZoneHandle(reader->zone(),
+                            TypedData::New(cid, len, reader->space()));
   reader->AddBackRef(object_id, &result, kIsDeserialized);
 
   // Setup the array elements.
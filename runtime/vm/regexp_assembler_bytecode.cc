@@ -8,14 +8,24 @@
 #include "vm/object_store.h"
 #include "vm/regexp.h"
 #include "vm/regexp_assembler.h"
+#include "vm/regexp_ast.h"
 #include "vm/regexp_assembler_bytecode_inl.h"
 #include "vm/regexp_bytecodes.h"
 #include "vm/regexp_interpreter.h"
+#include "vm/regexp_linear.h"
 #include "vm/regexp_parser.h"
+#include "vm/symbols.h"
 #include "vm/timeline.h"
 
 namespace dart {
 
+DEFINE_FLAG(int,
+            regexp_backtracks_before_fallback,
+            50000,
+            "Number of backtracks after which the bytecode interpreter retries "
+            "a match with the linear time matcher, if the pattern allows it. "
+            "0 means never.");
+
 BytecodeRegExpMacroAssembler::BytecodeRegExpMacroAssembler(
     ZoneGrowableArray<uint8_t>* buffer,
     Zone* zone)
@@ -419,6 +429,63 @@ void BytecodeRegExpMacroAssembler::Expand() {
     buffer_->Add(0);
 }
 
+// Appends the code units every match of [tree] starts with to [prefix].
+// Returns whether they are all of [tree]'s match, so that the code units of a
+// following tree can be appended as well.
+static bool AddLiteralPrefix(RegExpTree* tree,
+                             GrowableArray<uint16_t>* prefix) {
+  if (tree->IsAtom()) {
+    ZoneGrowableArray<uint16_t>* data = tree->AsAtom()->data();
+    for (intptr_t i = 0; i < data->length(); i++) {
+      prefix->Add(data->At(i));
+    }
+    return true;
+  }
+  if (tree->IsText()) {
+    GrowableArray<TextElement>* elements = tree->AsText()->elements();
+    for (intptr_t i = 0; i < elements->length(); i++) {
+      const TextElement& element = (*elements)[i];
+      if (element.text_type() != TextElement::ATOM) {
+        return false;
+      }
+      AddLiteralPrefix(element.atom(), prefix);
+    }
+    return true;
+  }
+  if (tree->IsAlternative()) {
+    ZoneGrowableArray<RegExpTree*>* nodes = tree->AsAlternative()->nodes();
+    for (intptr_t i = 0; i < nodes->length(); i++) {
+      if (!AddLiteralPrefix(nodes->At(i), prefix)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  if (tree->IsCapture()) {
+    return AddLiteralPrefix(tree->AsCapture()->body(), prefix);
+  }
+  if (tree->IsQuantifier()) {
+    if (tree->AsQuantifier()->min() > 0) {
+      AddLiteralPrefix(tree->AsQuantifier()->body(), prefix);
+    }
+    return false;
+  }
+  return tree->IsEmpty();
+}
+
+static RawString* LiteralPrefix(RegExpCompileData* compile_data,
+                                RegExpFlags flags) {
+  if (flags.IgnoreCase() || flags.IsUnicode()) {
+    return Symbols::Empty().raw();
+  }
+  GrowableArray<uint16_t> prefix;
+  AddLiteralPrefix(compile_data->tree, &prefix);
+  if (prefix.is_empty()) {
+    return Symbols::Empty().raw();
+  }
+  return String::FromUTF16(prefix.data(), prefix.length(), Heap::kOld);
+}
+
 static intptr_t Prepare(const RegExp& regexp,
                         const String& subject,
                         bool sticky,
@@ -444,6 +511,8 @@ static intptr_t Prepare(const RegExp& regexp,
 
     regexp.set_num_bracket_expressions(compile_data->capture_count);
     regexp.set_capture_name_map(compile_data->capture_name_map);
+    regexp.set_literal_prefix(
+        String::Handle(zone, LiteralPrefix(compile_data, regexp.flags())));
     if (compile_data->simple) {
       regexp.set_is_simple();
     } else {
@@ -490,11 +559,53 @@ static IrregexpInterpreter::IrregexpResult ExecRaw(const RegExp& regexp,
     raw_output[i] = -1;
   }
 
+  // Unless the match must start at [index], skip to the first position the
+  // literal prefix of the pattern occurs at.
+  const String& prefix = String::Handle(zone, regexp.literal_prefix());
+  if (!sticky && !prefix.IsNull() && (prefix.Length() > 0)) {
+    index = subject.IndexOf(prefix, index);
+    if (index < 0) {
+      return IrregexpInterpreter::RE_FAILURE;
+    }
+  }
+
   const TypedData& bytecode =
       TypedData::Handle(zone, regexp.bytecode(is_one_byte, sticky));
   ASSERT(!bytecode.IsNull());
-  IrregexpInterpreter::IrregexpResult result =
-      IrregexpInterpreter::Match(bytecode, subject, raw_output, index, zone);
+  // Once a pattern without a linear program has hit the backtrack limit,
+  // later matches skip the limited attempt, which would be thrown away.
+  Object& program = Object::Handle(zone, regexp.linear_program());
+  const intptr_t backtrack_limit = (program.raw() == Bool::False().raw())
+                                       ? 0
+                                       : FLAG_regexp_backtracks_before_fallback;
+  IrregexpInterpreter::IrregexpResult result = IrregexpInterpreter::Match(
+      bytecode, subject, raw_output, index, zone, backtrack_limit);
+
+  if (result == IrregexpInterpreter::RE_BACKTRACK_LIMIT) {
+    // The pattern backtracks excessively on this subject. Unless it needs
+    // backtracking, finish the match in time linear in the subject length.
+    if (program.IsNull()) {
+      const String& pattern = String::Handle(zone, regexp.pattern());
+      RegExpCompileData* compile_data = new (zone) RegExpCompileData();
+      RegExpParser::ParseRegExp(pattern, regexp.flags(), compile_data);
+      program = LinearRegExp::Compile(compile_data, regexp.flags(), zone);
+      if (program.IsNull()) {
+        regexp.set_linear_program(Bool::False());
+      } else {
+        regexp.set_linear_program(program);
+      }
+    }
+    for (int i = number_of_capture_registers - 1; i >= 0; i--) {
+      raw_output[i] = -1;
+    }
+    if (program.IsTypedData()) {
+      result = LinearRegExp::Match(TypedData::Cast(program), subject,
+                                   raw_output, index, sticky, zone);
+    } else {
+      result = IrregexpInterpreter::Match(bytecode, subject, raw_output, index,
+                                          zone);
+    }
+  }
 
   if (result == IrregexpInterpreter::RE_SUCCESS) {
     // Copy capture results to the start of the registers array.
@@ -149,7 +149,8 @@ static IrregexpInterpreter::IrregexpResult RawMatch(const uint8_t* code_base,
                                                     int32_t* registers,
                                                     intptr_t current,
                                                     uint32_t current_char,
-                                                    Zone* zone) {
+                                                    Zone* zone,
+                                                    intptr_t backtrack_limit) {
   const uint8_t* pc = code_base;
   // BacktrackStack ensures that the memory allocated for the backtracking stack
   // is returned to the system or cached if there is no stack being cached at
@@ -158,6 +159,7 @@ static IrregexpInterpreter::IrregexpResult RawMatch(const uint8_t* code_base,
   intptr_t* backtrack_stack_base = backtrack_stack.data();
   intptr_t* backtrack_sp = backtrack_stack_base;
   intptr_t backtrack_stack_space = backtrack_stack.max_size();
+  intptr_t backtracks_left = backtrack_limit;
 
   // TODO(zerny): Optimize as single instance. V8 has this as an
   // isolate member.
@@ -232,6 +234,9 @@ static IrregexpInterpreter::IrregexpResult RawMatch(const uint8_t* code_base,
       pc += BC_POP_CP_LENGTH;
       break;
       BYTECODE(POP_BT)
+      if ((backtrack_limit != 0) && (--backtracks_left == 0)) {
+        return IrregexpInterpreter::RE_BACKTRACK_LIMIT;
+      }
       backtrack_stack_space++;
       --backtrack_sp;
       pc = code_base + *backtrack_sp;
@@ -628,7 +633,8 @@ IrregexpInterpreter::IrregexpResult IrregexpInterpreter::Match(
     const String& subject,
     int32_t* registers,
     intptr_t start_position,
-    Zone* zone) {
+    Zone* zone,
+    intptr_t backtrack_limit) {
   NoSafepointScope no_safepoint;
   const uint8_t* code_base = reinterpret_cast<uint8_t*>(bytecode.DataAddr(0));
 
@@ -639,10 +645,10 @@ IrregexpInterpreter::IrregexpResult IrregexpInterpreter::Match(
 
   if (subject.IsOneByteString() || subject.IsExternalOneByteString()) {
     return RawMatch<uint8_t>(code_base, subject, registers, start_position,
-                             previous_char, zone);
+                             previous_char, zone, backtrack_limit);
   } else if (subject.IsTwoByteString() || subject.IsExternalTwoByteString()) {
     return RawMatch<uint16_t>(code_base, subject, registers, start_position,
-                              previous_char, zone);
+                              previous_char, zone, backtrack_limit);
   } else {
     UNREACHABLE();
     return IrregexpInterpreter::RE_FAILURE;
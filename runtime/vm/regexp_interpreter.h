@@ -15,13 +15,21 @@ namespace dart {
 
 class IrregexpInterpreter : public AllStatic {
  public:
-  enum IrregexpResult { RE_FAILURE = 0, RE_SUCCESS = 1, RE_EXCEPTION = -1 };
-
+  enum IrregexpResult {
+    RE_FAILURE = 0,
+    RE_SUCCESS = 1,
+    RE_EXCEPTION = -1,
+    RE_BACKTRACK_LIMIT = -2
+  };
+
+  // Gives up with RE_BACKTRACK_LIMIT after [backtrack_limit] backtracks, or
+  // never if it is 0.
   static IrregexpResult Match(const TypedData& bytecode,
                               const String& subject,
                               int32_t* captures,
                               intptr_t start_position,
-                              Zone* zone);
+                              Zone* zone,
+                              intptr_t backtrack_limit = 0);
 };
 
 }  // namespace dart
@@ -0,0 +1,568 @@
+// Copyright (c) 2019, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/regexp_linear.h"
+
+#include "vm/regexp_ast.h"
+
+namespace dart {
+
+// Each instruction is three int32 words: the opcode and two operands.
+enum LinearRegExpOp {
+  kConsumeRanges,     // Consume a code unit within ranges [a, a + b).
+  kConsumeNotRanges,  // Consume a code unit outside ranges [a, a + b).
+  kFork,              // Continue at a, and with lower priority at b.
+  kJump,              // Continue at a.
+  kSetRegister,       // Set register a to the current position.
+  kClearRegisters,    // Reset registers a to b inclusive to -1.
+  kAssertion,         // Continue if RegExpAssertion::AssertionType a holds.
+  kAccept,
+};
+
+// Program layout: instruction count, register count, the instructions, then
+// the ranges used by the consume instructions as pairs of inclusive bounds.
+static const intptr_t kInstructionCountIndex = 0;
+static const intptr_t kRegisterCountIndex = 1;
+static const intptr_t kHeaderSize = 2;
+static const intptr_t kInstructionSize = 3;
+
+// Bounds the memory used by the matcher, which is proportional to the
+// number of instructions.
+static const intptr_t kMaxInstructions = 4096;
+
+class LinearRegExpCompiler : public ValueObject {
+ public:
+  explicit LinearRegExpCompiler(Zone* zone)
+      : zone_(zone), code_(zone, 64), ranges_(zone, 16) {}
+
+  // Returns false if the tree cannot be matched without backtracking.
+  bool Compile(RegExpTree* tree);
+
+  intptr_t Emit(LinearRegExpOp op, intptr_t a = 0, intptr_t b = 0) {
+    const intptr_t pc = this->pc();
+    code_.Add(op);
+    code_.Add(a);
+    code_.Add(b);
+    return pc;
+  }
+
+  RawTypedData* MakeProgram(intptr_t register_count) const;
+
+ private:
+  intptr_t pc() const { return code_.length() / kInstructionSize; }
+  bool too_large() const { return pc() > kMaxInstructions; }
+
+  void PatchA(intptr_t pc, intptr_t a) { code_[pc * kInstructionSize + 1] = a; }
+  void PatchB(intptr_t pc, intptr_t b) { code_[pc * kInstructionSize + 2] = b; }
+
+  bool CompileDisjunction(RegExpDisjunction* disjunction);
+  bool CompileQuantifier(RegExpQuantifier* quantifier);
+  bool CompileIteration(RegExpTree* body, Interval captures);
+  void CompileAtom(RegExpAtom* atom);
+  void CompileCharacterClass(RegExpCharacterClass* character_class);
+
+  Zone* zone_;
+  GrowableArray<int32_t> code_;
+  GrowableArray<int32_t> ranges_;
+};
+
+bool LinearRegExpCompiler::Compile(RegExpTree* tree) {
+  if (too_large()) {
+    return false;
+  }
+  if (tree->IsDisjunction()) {
+    return CompileDisjunction(tree->AsDisjunction());
+  }
+  if (tree->IsAlternative()) {
+    ZoneGrowableArray<RegExpTree*>* nodes = tree->AsAlternative()->nodes();
+    for (intptr_t i = 0; i < nodes->length(); i++) {
+      if (!Compile(nodes->At(i))) {
+        return false;
+      }
+    }
+    return true;
+  }
+  if (tree->IsAssertion()) {
+    Emit(kAssertion, tree->AsAssertion()->assertion_type());
+    return true;
+  }
+  if (tree->IsCharacterClass()) {
+    CompileCharacterClass(tree->AsCharacterClass());
+    return true;
+  }
+  if (tree->IsAtom()) {
+    CompileAtom(tree->AsAtom());
+    return true;
+  }
+  if (tree->IsText()) {
+    GrowableArray<TextElement>* elements = tree->AsText()->elements();
+    for (intptr_t i = 0; i < elements->length(); i++) {
+      const TextElement& element = (*elements)[i];
+      if (element.text_type() == TextElement::ATOM) {
+        CompileAtom(element.atom());
+      } else {
+        CompileCharacterClass(element.char_class());
+      }
+    }
+    return true;
+  }
+  if (tree->IsQuantifier()) {
+    return CompileQuantifier(tree->AsQuantifier());
+  }
+  if (tree->IsCapture()) {
+    RegExpCapture* capture = tree->AsCapture();
+    Emit(kSetRegister, RegExpCapture::StartRegister(capture->index()));
+    if (!Compile(capture->body())) {
+      return false;
+    }
+    Emit(kSetRegister, RegExpCapture::EndRegister(capture->index()));
+    return true;
+  }
+  if (tree->IsEmpty()) {
+    return true;
+  }
+  // Back references and lookarounds.
+  return false;
+}
+
+bool LinearRegExpCompiler::CompileDisjunction(RegExpDisjunction* disjunction) {
+  ZoneGrowableArray<RegExpTree*>* alternatives = disjunction->alternatives();
+  GrowableArray<intptr_t> jumps_to_end;
+  for (intptr_t i = 0; i < alternatives->length(); i++) {
+    const bool is_last = i == (alternatives->length() - 1);
+    intptr_t fork = -1;
+    if (!is_last) {
+      fork = Emit(kFork, pc() + 1);
+    }
+    if (!Compile(alternatives->At(i))) {
+      return false;
+    }
+    if (!is_last) {
+      jumps_to_end.Add(Emit(kJump));
+      PatchB(fork, pc());
+    }
+  }
+  for (intptr_t i = 0; i < jumps_to_end.length(); i++) {
+    PatchA(jumps_to_end[i], pc());
+  }
+  return true;
+}
+
+// Captures inside a quantified body are reset at the start of every
+// iteration, as in the backtracking engine.
+bool LinearRegExpCompiler::CompileIteration(RegExpTree* body,
+                                            Interval captures) {
+  if (!captures.is_empty()) {
+    Emit(kClearRegisters, captures.from(), captures.to());
+  }
+  return Compile(body);
+}
+
+bool LinearRegExpCompiler::CompileQuantifier(RegExpQuantifier* quantifier) {
+  const intptr_t min = quantifier->min();
+  const intptr_t max = quantifier->max();
+  RegExpTree* body = quantifier->body();
+  if (!quantifier->is_greedy() && !quantifier->is_non_greedy()) {
+    return false;
+  }
+  // The backtracking engine stops iterating when an optional iteration
+  // matches the empty string, which a lock step matcher cannot observe.
+  if ((max > min) && (body->min_match() == 0)) {
+    return false;
+  }
+  if ((min > kMaxInstructions) ||
+      ((max != RegExpTree::kInfinity) && (max > kMaxInstructions))) {
+    return false;
+  }
+
+  const Interval captures = body->CaptureRegisters();
+  for (intptr_t i = 0; i < min; i++) {
+    if (too_large() || !CompileIteration(body, captures)) {
+      return false;
+    }
+  }
+
+  if (max == RegExpTree::kInfinity) {
+    const intptr_t loop = Emit(kFork);
+    if (!CompileIteration(body, captures)) {
+      return false;
+    }
+    Emit(kJump, loop);
+    if (quantifier->is_greedy()) {
+      PatchA(loop, loop + 1);
+      PatchB(loop, pc());
+    } else {
+      PatchA(loop, pc());
+      PatchB(loop, loop + 1);
+    }
+    return true;
+  }
+
+  // Each optional iteration may be skipped, which also skips the rest.
+  GrowableArray<intptr_t> forks;
+  for (intptr_t i = min; i < max; i++) {
+    if (too_large()) {
+      return false;
+    }
+    forks.Add(Emit(kFork));
+    if (!CompileIteration(body, captures)) {
+      return false;
+    }
+  }
+  for (intptr_t i = 0; i < forks.length(); i++) {
+    if (quantifier->is_greedy()) {
+      PatchA(forks[i], forks[i] + 1);
+      PatchB(forks[i], pc());
+    } else {
+      PatchA(forks[i], pc());
+      PatchB(forks[i], forks[i] + 1);
+    }
+  }
+  return true;
+}
+
+void LinearRegExpCompiler::CompileAtom(RegExpAtom* atom) {
+  ZoneGrowableArray<uint16_t>* data = atom->data();
+  for (intptr_t i = 0; i < data->length(); i++) {
+    const intptr_t index = ranges_.length() / 2;
+    ranges_.Add(data->At(i));
+    ranges_.Add(data->At(i));
+    Emit(kConsumeRanges, index, 1);
+  }
+}
+
+void LinearRegExpCompiler::CompileCharacterClass(
+    RegExpCharacterClass* character_class) {
+  // Canonicalize a copy, the tree may still be compiled by irregexp.
+  ZoneGrowableArray<CharacterRange>* original = character_class->ranges();
+  ZoneGrowableArray<CharacterRange>* ranges =
+      new (zone_) ZoneGrowableArray<CharacterRange>(original->length());
+  for (intptr_t i = 0; i < original->length(); i++) {
+    ranges->Add(original->At(i));
+  }
+  CharacterRange::Canonicalize(ranges);
+
+  const intptr_t index = ranges_.length() / 2;
+  for (intptr_t i = 0; i < ranges->length(); i++) {
+    ranges_.Add(ranges->At(i).from());
+    ranges_.Add(ranges->At(i).to());
+  }
+  Emit(character_class->is_negated() ? kConsumeNotRanges : kConsumeRanges,
+       index, ranges->length());
+}
+
+RawTypedData* LinearRegExpCompiler::MakeProgram(intptr_t register_count) const {
+  const intptr_t length = kHeaderSize + code_.length() + ranges_.length();
+  const TypedData& program = TypedData::Handle(
+      zone_, TypedData::New(kTypedDataInt32ArrayCid, length, Heap::kOld));
+  NoSafepointScope no_safepoint;
+  int32_t* data = reinterpret_cast<int32_t*>(program.DataAddr(0));
+  data[kInstructionCountIndex] = pc();
+  data[kRegisterCountIndex] = register_count;
+  memmove(&data[kHeaderSize], code_.data(), code_.length() * sizeof(int32_t));
+  memmove(&data[kHeaderSize + code_.length()], ranges_.data(),
+          ranges_.length() * sizeof(int32_t));
+  return program.raw();
+}
+
+RawTypedData* LinearRegExp::Compile(RegExpCompileData* data,
+                                    RegExpFlags flags,
+                                    Zone* zone) {
+  if (flags.IgnoreCase() || flags.IsUnicode()) {
+    return TypedData::null();
+  }
+  LinearRegExpCompiler compiler(zone);
+  compiler.Emit(kSetRegister, RegExpCapture::StartRegister(0));
+  if (!compiler.Compile(data->tree)) {
+    return TypedData::null();
+  }
+  compiler.Emit(kSetRegister, RegExpCapture::EndRegister(0));
+  compiler.Emit(kAccept);
+  return compiler.MakeProgram((data->capture_count + 1) * 2);
+}
+
+class LinearRegExpMatcher : public ValueObject {
+ public:
+  LinearRegExpMatcher(const int32_t* program,
+                      const String& subject,
+                      Zone* zone)
+      : instruction_count_(program[kInstructionCountIndex]),
+        register_count_(program[kRegisterCountIndex]),
+        code_(&program[kHeaderSize]),
+        ranges_(&program[kHeaderSize + instruction_count_ * kInstructionSize]),
+        subject_(subject),
+        length_(subject.Length()),
+        zone_(zone),
+        visited_(zone->Alloc<intptr_t>(instruction_count_)),
+        generation_(0),
+        stack_pcs_(zone->Alloc<intptr_t>(2 * instruction_count_ + 1)),
+        stack_registers_(zone->Alloc<int32_t*>(2 * instruction_count_ + 1)),
+        free_registers_(zone->Alloc<int32_t*>(4 * instruction_count_ + 2)),
+        free_count_(0) {
+    for (intptr_t i = 0; i < instruction_count_; i++) {
+      visited_[i] = -1;
+    }
+    current_.Init(zone, instruction_count_);
+    next_.Init(zone, instruction_count_);
+  }
+
+  bool Match(int32_t* captures, intptr_t start, bool sticky);
+
+ private:
+  // Threads waiting on a consume or accept instruction, highest priority
+  // first. There is at most one thread per instruction.
+  struct ThreadList {
+    void Init(Zone* zone, intptr_t capacity) {
+      pcs = zone->Alloc<intptr_t>(capacity);
+      registers = zone->Alloc<int32_t*>(capacity);
+      length = 0;
+    }
+    intptr_t* pcs;
+    int32_t** registers;
+    intptr_t length;
+  };
+
+  int32_t Op(intptr_t pc) const { return code_[pc * kInstructionSize]; }
+  int32_t A(intptr_t pc) const { return code_[pc * kInstructionSize + 1]; }
+  int32_t B(intptr_t pc) const { return code_[pc * kInstructionSize + 2]; }
+
+  int32_t* NewRegisters() {
+    if (free_count_ > 0) {
+      return free_registers_[--free_count_];
+    }
+    return zone_->Alloc<int32_t>(register_count_);
+  }
+
+  int32_t* CopyRegisters(const int32_t* registers) {
+    int32_t* copy = NewRegisters();
+    memmove(copy, registers, register_count_ * sizeof(int32_t));
+    return copy;
+  }
+
+  void FreeRegisters(int32_t* registers) {
+    free_registers_[free_count_++] = registers;
+  }
+
+  bool InRanges(uint32_t ch, intptr_t index, intptr_t count) const {
+    const int32_t* ranges = &ranges_[index * 2];
+    intptr_t lo = 0;
+    intptr_t hi = count;
+    while (lo < hi) {
+      const intptr_t mid = lo + (hi - lo) / 2;
+      if (ch < static_cast<uint32_t>(ranges[mid * 2])) {
+        hi = mid;
+      } else if (ch > static_cast<uint32_t>(ranges[mid * 2 + 1])) {
+        lo = mid + 1;
+      } else {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  static bool IsLineTerminator(uint32_t ch) {
+    return (ch == '\n') || (ch == '\r') || (ch == 0x2028) || (ch == 0x2029);
+  }
+
+  bool IsWordCharAt(intptr_t pos) const {
+    if ((pos < 0) || (pos >= length_)) {
+      return false;
+    }
+    const uint32_t ch = subject_.CharAt(pos);
+    return ((ch >= 'a') && (ch <= 'z')) || ((ch >= 'A') && (ch <= 'Z')) ||
+           ((ch >= '0') && (ch <= '9')) || (ch == '_');
+  }
+
+  bool CheckAssertion(intptr_t type, intptr_t pos) const {
+    switch (type) {
+      case RegExpAssertion::START_OF_INPUT:
+        return pos == 0;
+      case RegExpAssertion::END_OF_INPUT:
+        return pos == length_;
+      case RegExpAssertion::START_OF_LINE:
+        return (pos == 0) || IsLineTerminator(subject_.CharAt(pos - 1));
+      case RegExpAssertion::END_OF_LINE:
+        return (pos == length_) || IsLineTerminator(subject_.CharAt(pos));
+      case RegExpAssertion::BOUNDARY:
+        return IsWordCharAt(pos - 1) != IsWordCharAt(pos);
+      case RegExpAssertion::NON_BOUNDARY:
+        return IsWordCharAt(pos - 1) == IsWordCharAt(pos);
+    }
+    UNREACHABLE();
+    return false;
+  }
+
+  void AddThread(ThreadList* list, intptr_t pc, int32_t* registers,
+                 intptr_t pos);
+
+  const intptr_t instruction_count_;
+  const intptr_t register_count_;
+  const int32_t* code_;
+  const int32_t* ranges_;
+  const String& subject_;
+  const intptr_t length_;
+  Zone* zone_;
+
+  // The generation in which an instruction was last reached. Each position
+  // in the subject is a new generation.
+  intptr_t* visited_;
+  intptr_t generation_;
+
+  // Work list for following the non-consuming instructions.
+  intptr_t* stack_pcs_;
+  int32_t** stack_registers_;
+
+  int32_t** free_registers_;
+  intptr_t free_count_;
+
+  ThreadList current_;
+  ThreadList next_;
+};
+
+// Follows the non-consuming instructions from [pc] at [pos] in priority order
+// and adds the reached consume and accept instructions to [list]. Takes
+// ownership of [registers].
+void LinearRegExpMatcher::AddThread(ThreadList* list,
+                                    intptr_t pc,
+                                    int32_t* registers,
+                                    intptr_t pos) {
+  intptr_t stack_length = 0;
+  stack_pcs_[stack_length] = pc;
+  stack_registers_[stack_length] = registers;
+  stack_length++;
+  while (stack_length > 0) {
+    stack_length--;
+    pc = stack_pcs_[stack_length];
+    registers = stack_registers_[stack_length];
+    if (visited_[pc] == generation_) {
+      // A higher priority thread already reached this instruction.
+      FreeRegisters(registers);
+      continue;
+    }
+    visited_[pc] = generation_;
+    switch (Op(pc)) {
+      case kJump:
+        stack_pcs_[stack_length] = A(pc);
+        stack_registers_[stack_length] = registers;
+        stack_length++;
+        break;
+      case kFork:
+        // Pushed last so the preferred branch is followed first.
+        stack_pcs_[stack_length] = B(pc);
+        stack_registers_[stack_length] = CopyRegisters(registers);
+        stack_length++;
+        stack_pcs_[stack_length] = A(pc);
+        stack_registers_[stack_length] = registers;
+        stack_length++;
+        break;
+      case kSetRegister:
+        registers[A(pc)] = pos;
+        stack_pcs_[stack_length] = pc + 1;
+        stack_registers_[stack_length] = registers;
+        stack_length++;
+        break;
+      case kClearRegisters:
+        for (intptr_t i = A(pc); i <= B(pc); i++) {
+          registers[i] = -1;
+        }
+        stack_pcs_[stack_length] = pc + 1;
+        stack_registers_[stack_length] = registers;
+        stack_length++;
+        break;
+      case kAssertion:
+        if (CheckAssertion(A(pc), pos)) {
+          stack_pcs_[stack_length] = pc + 1;
+          stack_registers_[stack_length] = registers;
+          stack_length++;
+        } else {
+          FreeRegisters(registers);
+        }
+        break;
+      default:
+        ASSERT((Op(pc) == kConsumeRanges) || (Op(pc) == kConsumeNotRanges) ||
+               (Op(pc) == kAccept));
+        list->pcs[list->length] = pc;
+        list->registers[list->length] = registers;
+        list->length++;
+        break;
+    }
+  }
+}
+
+bool LinearRegExpMatcher::Match(int32_t* captures,
+                                intptr_t start,
+                                bool sticky) {
+  bool matched = false;
+  current_.length = 0;
+  generation_++;
+  for (intptr_t pos = start; pos <= length_; pos++) {
+    // A new attempt at this position has the lowest priority, and none is
+    // needed once a match was found.
+    if (!matched && (!sticky || (pos == start))) {
+      int32_t* registers = NewRegisters();
+      for (intptr_t i = 0; i < register_count_; i++) {
+        registers[i] = -1;
+      }
+      AddThread(&current_, 0, registers, pos);
+    }
+    if (current_.length == 0) {
+      if (matched || sticky) {
+        break;
+      }
+      generation_++;
+      continue;
+    }
+
+    generation_++;
+    next_.length = 0;
+    for (intptr_t i = 0; i < current_.length; i++) {
+      const intptr_t pc = current_.pcs[i];
+      int32_t* registers = current_.registers[i];
+      const int32_t op = Op(pc);
+      if (op == kAccept) {
+        // Lower priority threads can no longer produce the match.
+        matched = true;
+        memmove(captures, registers, register_count_ * sizeof(int32_t));
+        for (intptr_t j = i; j < current_.length; j++) {
+          FreeRegisters(current_.registers[j]);
+        }
+        break;
+      }
+      const bool consumes =
+          (pos < length_) && (InRanges(subject_.CharAt(pos), A(pc), B(pc)) ==
+                              (op == kConsumeRanges));
+      if (consumes) {
+        AddThread(&next_, pc + 1, registers, pos + 1);
+      } else {
+        FreeRegisters(registers);
+      }
+    }
+
+    ThreadList swap = current_;
+    current_ = next_;
+    next_ = swap;
+  }
+  for (intptr_t i = 0; i < current_.length; i++) {
+    FreeRegisters(current_.registers[i]);
+  }
+  return matched;
+}
+
+IrregexpInterpreter::IrregexpResult LinearRegExp::Match(
+    const TypedData& program,
+    const String& subject,
+    int32_t* captures,
+    intptr_t start_position,
+    bool sticky,
+    Zone* zone) {
+  ASSERT(program.GetClassId() == kTypedDataInt32ArrayCid);
+  NoSafepointScope no_safepoint;
+  const int32_t* code = reinterpret_cast<const int32_t*>(program.DataAddr(0));
+  LinearRegExpMatcher matcher(code, subject, zone);
+  const bool matched = matcher.Match(captures, start_position, sticky);
+  return matched ? IrregexpInterpreter::RE_SUCCESS
+                 : IrregexpInterpreter::RE_FAILURE;
+}
+
+}  // namespace dart
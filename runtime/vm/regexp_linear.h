@@ -0,0 +1,46 @@
+// Copyright (c) 2019, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// A matcher for regular expressions without back references or lookarounds
+// that runs in time linear in the length of the subject.
+
+#ifndef RUNTIME_VM_REGEXP_LINEAR_H_
+#define RUNTIME_VM_REGEXP_LINEAR_H_
+
+#include "vm/allocation.h"
+#include "vm/object.h"
+#include "vm/regexp.h"
+#include "vm/regexp_interpreter.h"
+#include "vm/zone.h"
+
+namespace dart {
+
+// Instead of backtracking, the matcher advances all alternatives in lock step
+// over the subject (a Pike VM). Alternatives are kept in the order in which
+// the backtracking engine would try them, so the match and its captures are
+// the same as irregexp's.
+class LinearRegExp : public AllStatic {
+ public:
+  // Compiles the parsed pattern into a program for [Match]. Returns null if
+  // the pattern uses back references, lookarounds, case-insensitive or
+  // unicode matching, a quantifier whose body can match the empty string, or
+  // if the program would be too large.
+  static RawTypedData* Compile(RegExpCompileData* data,
+                               RegExpFlags flags,
+                               Zone* zone);
+
+  // Finds the first match starting at or after [start_position], or exactly
+  // at [start_position] if [sticky], and stores its capture registers in
+  // [captures].
+  static IrregexpInterpreter::IrregexpResult Match(const TypedData& program,
+                                                   const String& subject,
+                                                   int32_t* captures,
+                                                   intptr_t start_position,
+                                                   bool sticky,
+                                                   Zone* zone);
+};
+
+}  // namespace dart
+
+#endif  // RUNTIME_VM_REGEXP_LINEAR_H_
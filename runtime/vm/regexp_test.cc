@@ -7,11 +7,14 @@
 #include "vm/isolate.h"
 #include "vm/object.h"
 #include "vm/regexp.h"
+#include "vm/regexp_assembler_bytecode.h"
 #include "vm/regexp_assembler_ir.h"
 #include "vm/unit_test.h"
 
 namespace dart {
 
+DECLARE_FLAG(int, regexp_backtracks_before_fallback);
+
 static RawArray* Match(const String& pat, const String& str) {
   Thread* thread = Thread::Current();
   Zone* zone = thread->zone();
@@ -110,4 +113,153 @@ ISOLATE_UNIT_TEST_CASE(RegExp_ExternalTwoByteString) {
   EXPECT_EQ(3, smi_2.Value());
 }
 
+static RawInstance* Interpret(const char* pattern,
+                              int flags,
+                              const String& subject,
+                              intptr_t start,
+                              bool sticky,
+                              intptr_t backtrack_limit) {
+  Thread* thread = Thread::Current();
+  Zone* zone = thread->zone();
+  SetFlagScope<bool> interpret(&FLAG_interpret_irregexp, true);
+  SetFlagScope<int> limit(&FLAG_regexp_backtracks_before_fallback,
+                          backtrack_limit);
+  const RegExp& regexp = RegExp::Handle(RegExpEngine::CreateRegExp(
+      thread, String::Handle(String::New(pattern)), RegExpFlags(flags)));
+  return BytecodeRegExpMacroAssembler::Interpret(
+      regexp, subject, Smi::Handle(Smi::New(start)), sticky, zone);
+}
+
+// Matches with the linear time matcher after the first backtrack and checks
+// that the match and captures are the same as the backtracking interpreter's.
+static void ExpectSameMatch(const char* pattern,
+                            int flags,
+                            const String& subject,
+                            intptr_t start = 0,
+                            bool sticky = false) {
+  const Instance& expected = Instance::Handle(
+      Interpret(pattern, flags, subject, start, sticky, /*backtrack_limit=*/0));
+  const Instance& actual = Instance::Handle(
+      Interpret(pattern, flags, subject, start, sticky, /*backtrack_limit=*/1));
+  EXPECT_EQ(expected.IsNull(), actual.IsNull());
+  if (expected.IsNull() || actual.IsNull()) {
+    return;
+  }
+  const TypedData& expected_captures = TypedData::Cast(expected);
+  const TypedData& actual_captures = TypedData::Cast(actual);
+  EXPECT_EQ(expected_captures.Length(), actual_captures.Length());
+  for (intptr_t i = 0; i < expected_captures.Length(); i++) {
+    EXPECT_EQ(expected_captures.GetInt32(i * sizeof(int32_t)),
+              actual_captures.GetInt32(i * sizeof(int32_t)));
+  }
+}
+
+ISOLATE_UNIT_TEST_CASE(RegExp_LinearFallback) {
+  const String& abc = String::Handle(String::New("xxabcabcabd yy"));
+  ExpectSameMatch("abd", RegExpFlags::kNone, abc);
+  ExpectSameMatch("(abc)+", RegExpFlags::kNone, abc);
+  ExpectSameMatch("(abc)+?", RegExpFlags::kNone, abc);
+  ExpectSameMatch("(a|ab)(c|bcd)(d*)", RegExpFlags::kNone, abc);
+  ExpectSameMatch("(?:(a)|b|c)*d", RegExpFlags::kNone, abc);
+  ExpectSameMatch("(?:(a)|(b)|c){2,4}", RegExpFlags::kNone, abc);
+  ExpectSameMatch("[^a-c]{2}", RegExpFlags::kNone, abc);
+  ExpectSameMatch("\\bab.\\b", RegExpFlags::kNone, abc);
+  ExpectSameMatch("\\Bc\\w+\\s", RegExpFlags::kNone, abc);
+  ExpectSameMatch("^x+|y+$", RegExpFlags::kNone, abc);
+  ExpectSameMatch("y$", RegExpFlags::kNone, abc);
+  ExpectSameMatch("abc", RegExpFlags::kNone, abc, 3);
+  ExpectSameMatch("abc", RegExpFlags::kNone, abc, 3, /*sticky=*/true);
+  ExpectSameMatch("abc", RegExpFlags::kNone, abc, 4, /*sticky=*/true);
+  ExpectSameMatch("abe", RegExpFlags::kNone, abc);
+
+  const String& lines = String::Handle(String::New("one\ntwo\r\nthree"));
+  ExpectSameMatch("^t\\w*$", RegExpFlags::kMultiLine, lines);
+  ExpectSameMatch("o.t", RegExpFlags::kDotAll, lines);
+
+  uint16_t chars[] = {'a', 0x3b1, 0x3b2, 'b', 0x3b1, 'b'};
+  const String& two_byte = String::Handle(
+      TwoByteString::New(chars, ARRAY_SIZE(chars), Heap::kNew));
+  ExpectSameMatch("[\\u03b1-\\u03b9]+b", RegExpFlags::kNone, two_byte);
+  ExpectSameMatch("(\\u03b1|b)+$", RegExpFlags::kNone, two_byte);
+
+  // Patterns the linear time matcher does not support fall back to the
+  // backtracking interpreter.
+  ExpectSameMatch("(a)bc\\1", RegExpFlags::kNone, abc);
+  ExpectSameMatch("ab(?=d)", RegExpFlags::kNone, abc);
+  ExpectSameMatch("ABD", RegExpFlags::kIgnoreCase, abc);
+  ExpectSameMatch("(a*)*d", RegExpFlags::kNone, abc);
+}
+
+ISOLATE_UNIT_TEST_CASE(RegExp_LinearFallbackCatastrophic) {
+  const intptr_t kLength = 64;
+  uint8_t chars[kLength];
+  for (intptr_t i = 0; i < kLength; i++) {
+    chars[i] = 'a';
+  }
+  const String& subject =
+      String::Handle(OneByteString::New(chars, kLength, Heap::kNew));
+  // Needs exponential time without the fallback.
+  const Instance& result = Instance::Handle(
+      Interpret("^(a+)+$b", RegExpFlags::kNone, subject, 0, false, 1000));
+  EXPECT(result.IsNull());
+}
+
+static RawObject* LinearProgramAfterFallback(const char* pattern,
+                                             const String& subject) {
+  Thread* thread = Thread::Current();
+  Zone* zone = thread->zone();
+  SetFlagScope<bool> interpret(&FLAG_interpret_irregexp, true);
+  SetFlagScope<int> limit(&FLAG_regexp_backtracks_before_fallback, 1);
+  const RegExp& regexp = RegExp::Handle(RegExpEngine::CreateRegExp(
+      thread, String::Handle(String::New(pattern)), RegExpFlags()));
+  EXPECT(regexp.linear_program() == Object::null());
+  BytecodeRegExpMacroAssembler::Interpret(regexp, subject, Object::smi_zero(),
+                                          /*sticky=*/false, zone);
+  const Object& program = Object::Handle(regexp.linear_program());
+  // Later matches reuse the program, or the fact that there is none.
+  BytecodeRegExpMacroAssembler::Interpret(regexp, subject, Object::smi_zero(),
+                                          /*sticky=*/false, zone);
+  EXPECT(regexp.linear_program() == program.raw());
+  return program.raw();
+}
+
+ISOLATE_UNIT_TEST_CASE(RegExp_LinearProgramCached) {
+  const String& subject = String::Handle(String::New("xxabcabcabd yy"));
+  EXPECT(Object::Handle(LinearProgramAfterFallback("(abc)+d", subject))
+             .IsTypedData());
+  EXPECT(LinearProgramAfterFallback("(a)bc\\1d", subject) ==
+         Bool::False().raw());
+}
+
+ISOLATE_UNIT_TEST_CASE(RegExp_LiteralPrefix) {
+  const String& subject =
+      String::Handle(String::New("foo bar foobaz foobar1 foobar2"));
+  TypedData& captures = TypedData::Handle();
+  captures ^= Interpret("(foo)bar(\\d)", RegExpFlags::kNone, subject, 0, false,
+                        /*backtrack_limit=*/0);
+  EXPECT(!captures.IsNull());
+  EXPECT_EQ(15, captures.GetInt32(0));
+  EXPECT_EQ(22, captures.GetInt32(sizeof(int32_t)));
+  EXPECT_EQ(21, captures.GetInt32(4 * sizeof(int32_t)));
+
+  captures ^= Interpret("(foo)bar(\\d)", RegExpFlags::kNone, subject, 16, false,
+                        /*backtrack_limit=*/0);
+  EXPECT(!captures.IsNull());
+  EXPECT_EQ(23, captures.GetInt32(0));
+
+  captures ^= Interpret("foobar3", RegExpFlags::kNone, subject, 0, false,
+                        /*backtrack_limit=*/0);
+  EXPECT(captures.IsNull());
+
+  // Lookbehinds see the characters before the skipped to position.
+  captures ^= Interpret("b(?<=o b)ar", RegExpFlags::kNone, subject, 0, false,
+                        /*backtrack_limit=*/0);
+  EXPECT(!captures.IsNull());
+  EXPECT_EQ(4, captures.GetInt32(0));
+  captures ^= Interpret("b(?<=oob)ar", RegExpFlags::kNone, subject, 0, false,
+                        /*backtrack_limit=*/0);
+  EXPECT(!captures.IsNull());
+  EXPECT_EQ(18, captures.GetInt32(0));
+}
+
 }  // namespace dart
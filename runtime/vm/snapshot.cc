@@ -28,6 +28,12 @@
 
 namespace dart {
 
+DEFINE_FLAG(int,
+            message_old_space_threshold,
+            1 * MB,
+            "Deserialize messages whose snapshot is larger than this many "
+            "bytes directly into old space.");
+
 static const int kNumInitialReferences = 32;
 
 static bool IsSingletonClassId(intptr_t class_id) {
@@ -207,6 +213,7 @@ SnapshotReader::SnapshotReader(const uint8_t* buffer,
       zone_(thread->zone()),
       heap_(isolate()->heap()),
       old_space_(thread_->isolate()->heap()->old_space()),
+      allocate_in_old_space_(false),
       cls_(Class::Handle(zone_)),
       code_(Code::Handle(zone_)),
       instance_(Instance::Handle(zone_)),
@@ -529,7 +536,7 @@ RawObject* SnapshotReader::ReadInstance(intptr_t object_id,
     instance_size = cls_.instance_size();
     ASSERT(instance_size > 0);
     // Allocate the instance and read in all the fields for the object.
-    *result ^= Object::Allocate(cls_.id(), instance_size, Heap::kNew);
+    *result ^= Object::Allocate(cls_.id(), instance_size, space());
   } else {
     cls_ ^= ReadObjectImpl(kAsInlinedObject);
     ASSERT(!cls_.IsNull());
@@ -806,7 +813,15 @@ MessageSnapshotReader::MessageSnapshotReader(Message* message, Thread* thread)
                      Snapshot::kMessage,
                      new ZoneGrowableArray<BackRefNode>(kNumInitialReferences),
                      thread),
-      finalizable_data_(message->finalizable_data()) {}
+      finalizable_data_(message->finalizable_data()) {
+  // Every object of a message stays reachable through the backward reference
+  // table until the whole graph has been read, so scavenges triggered while
+  // reading a large message only copy and promote the partially read graph.
+  // Allocate such graphs directly in old space instead.
+  if (message->snapshot_length() >= FLAG_message_old_space_threshold) {
+    set_allocate_in_old_space(true);
+  }
+}
 
 MessageSnapshotReader::~MessageSnapshotReader() {
   ResetBackwardReferenceTable();
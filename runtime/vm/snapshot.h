@@ -302,6 +302,14 @@ class SnapshotReader : public BaseReader {
   Zone* zone() const { return zone_; }
   Isolate* isolate() const { return thread_->isolate(); }
   Heap* heap() const { return heap_; }
+  // Whether deserialized objects are allocated directly in old space.
+  bool allocate_in_old_space() const { return allocate_in_old_space_; }
+  // The space deserialized objects are allocated in. Heap is incomplete in
+  // this header, so the space type is resolved where this is called.
+  template <typename HeapType = Heap>
+  typename HeapType::Space space() const {
+    return allocate_in_old_space_ ? HeapType::kOld : HeapType::kNew;
+  }
   ObjectStore* object_store() const { return isolate()->object_store(); }
   ClassTable* class_table() const { return isolate()->class_table(); }
   PassiveObject* PassiveObjectHandle() { return &pobj_; }
@@ -348,6 +356,7 @@ class SnapshotReader : public BaseReader {
   }
   void ResetBackwardReferenceTable() { backward_references_ = NULL; }
   PageSpace* old_space() const { return old_space_; }
+  void set_allocate_in_old_space(bool value) { allocate_in_old_space_ = value; }
 
  private:
   void EnqueueTypePostprocessing(const AbstractType& type);
@@ -395,6 +404,7 @@ class SnapshotReader : public BaseReader {
   Zone* zone_;                     // Zone for allocations while reading.
   Heap* heap_;                     // Heap of the current isolate.
   PageSpace* old_space_;           // Old space of the current isolate.
+  bool allocate_in_old_space_;     // Allocate read objects in old space.
   Class& cls_;                     // Temporary Class handle.
   Code& code_;                     // Temporary Code handle.
   Instance& instance_;             // Temporary Instance handle
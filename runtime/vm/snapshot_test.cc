@@ -22,6 +22,8 @@
 
 namespace dart {
 
+DECLARE_FLAG(int, message_old_space_threshold);
+
 // Check if serialized and deserialized objects are equal.
 static bool Equals(const Object& expected, const Object& actual) {
   if (expected.IsNull()) {
@@ -467,6 +469,42 @@ ISOLATE_UNIT_TEST_CASE(SerializeArray) {
   CheckEncodeDecodeMessage(root);
 }
 
+ISOLATE_UNIT_TEST_CASE(SerializeLargeMessageIntoOldSpace) {
+  const int kArrayLength = 10;
+  Array& array = Array::Handle(Array::New(kArrayLength));
+  String& str = String::Handle();
+  for (int i = 0; i < kArrayLength; i++) {
+    str = String::New("This string shall be serialized");
+    array.SetAt(i, str);
+  }
+  MessageWriter writer(true);
+  std::unique_ptr<Message> message =
+      writer.WriteMessage(array, ILLEGAL_PORT, Message::kNormalPriority);
+
+  // Small messages are read into new space.
+  {
+    MessageSnapshotReader reader(message.get(), thread);
+    Array& serialized_array = Array::Handle();
+    serialized_array ^= reader.ReadObject();
+    EXPECT(serialized_array.raw()->IsNewObject());
+    EXPECT(serialized_array.At(0)->IsNewObject());
+  }
+
+  // Messages above the threshold are read directly into old space.
+  {
+    SetFlagScope<int> sfs(&FLAG_message_old_space_threshold, 0);
+    MessageSnapshotReader reader(message.get(), thread);
+    Array& serialized_array = Array::Handle();
+    serialized_array ^= reader.ReadObject();
+    EXPECT(serialized_array.raw()->IsOldObject());
+    for (int i = 0; i < kArrayLength; i++) {
+      EXPECT(serialized_array.At(i)->IsOldObject());
+      str ^= serialized_array.At(i);
+      EXPECT(str.Equals("This string shall be serialized"));
+    }
+  }
+}
+
 ISOLATE_UNIT_TEST_CASE(SerializeArrayWithTypeArgument) {
   // Write snapshot with object content.
   const int kArrayLength = 10;
@@ -4,6 +4,8 @@
 
 #include "vm/symbols.h"
 
+#include <atomic>
+
 #include "platform/unicode.h"
 #include "vm/handles.h"
 #include "vm/hash_table.h"
@@ -191,6 +193,19 @@ class SymbolTraits {
 };
 typedef UnorderedHashSet<SymbolTraits> SymbolTable;
 
+// Probes the symbol table like SymbolTraits but without holding the symbols
+// mutex. Pairs with the release fence in Symbols::NewSymbol, so that a symbol
+// read from a table slot is seen fully initialized.
+class ConcurrentSymbolTraits : public SymbolTraits {
+ public:
+  template <typename Key>
+  static bool IsMatch(const Key& key, const Object& obj) {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return SymbolTraits::IsMatch(key, obj);
+  }
+};
+typedef UnorderedHashSet<ConcurrentSymbolTraits> ConcurrentSymbolTable;
+
 const char* Symbols::Name(SymbolId symbol) {
   ASSERT((symbol > kIllegal) && (symbol < kNullCharId));
   return names[symbol];
@@ -563,6 +578,28 @@ RawString* Symbols::FromConcatAll(
   }
 }
 
+// Looks [str] up in the isolate's symbol table without taking the symbols
+// mutex. Symbols are only added under the mutex, are fully initialized before
+// they are stored into the table, and are never removed while mutators run.
+// A table that grows is replaced by a new array instead of being rehashed in
+// place. A racing lookup may therefore miss a symbol that is being added, but
+// never sees a partially added one, so callers retry misses under the mutex.
+template <typename StringType>
+static RawObject* LookupWithoutLock(Thread* thread,
+                                    const StringType& str,
+                                    dart::Object* key,
+                                    Smi* value,
+                                    Array* data) {
+  *data = thread->isolate()->object_store()->symbol_table();
+  // Pairs with the release fence in Symbols::NewSymbol that publishes a grown
+  // table: its length and slots must not be read before the table itself.
+  std::atomic_thread_fence(std::memory_order_acquire);
+  ConcurrentSymbolTable table(key, value, data);
+  RawObject* symbol = table.GetOrNull(str);
+  table.Release();
+  return symbol;
+}
+
 // StringType can be StringSlice, ConcatString, or {Latin1,UTF16,UTF32}Array.
 template <typename StringType>
 RawString* Symbols::NewSymbol(Thread* thread, const StringType& str) {
@@ -580,12 +617,25 @@ RawString* Symbols::NewSymbol(Thread* thread, const StringType& str) {
     symbol ^= table.GetOrNull(str);
     table.Release();
   }
+  if (symbol.IsNull()) {
+    symbol ^= LookupWithoutLock(thread, str, &key, &value, &data);
+  }
   if (symbol.IsNull()) {
     Isolate* isolate = thread->isolate();
     SafepointMutexLocker ml(isolate->symbols_mutex());
     data = isolate->object_store()->symbol_table();
     SymbolTable table(&key, &value, &data);
-    symbol ^= table.InsertNewOrGet(str);
+    symbol ^= table.GetOrNull(str);
+    if (symbol.IsNull()) {
+      symbol ^= SymbolTraits::NewKey(str);
+      // Readers that do not take the lock must see the symbol's contents
+      // before they can see the symbol in the table.
+      std::atomic_thread_fence(std::memory_order_release);
+      table.Insert(symbol);
+    }
+    // The table is replaced by a new one when it grows. Publish the new
+    // table's contents before the table.
+    std::atomic_thread_fence(std::memory_order_release);
     isolate->object_store()->set_symbol_table(table.Release());
   }
   ASSERT(symbol.IsSymbol());
@@ -609,6 +659,9 @@ RawString* Symbols::Lookup(Thread* thread, const StringType& str) {
     symbol ^= table.GetOrNull(str);
     table.Release();
   }
+  if (symbol.IsNull()) {
+    symbol ^= LookupWithoutLock(thread, str, &key, &value, &data);
+  }
   if (symbol.IsNull()) {
     Isolate* isolate = thread->isolate();
     SafepointMutexLocker ml(isolate->symbols_mutex());
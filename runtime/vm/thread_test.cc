@@ -963,4 +963,98 @@ ISOLATE_UNIT_TEST_CASE(ExerciseTLABs) {
   }
 }
 
+class SymbolLookupTask : public ThreadPool::Task {
+ public:
+  static const intptr_t kSymbolCount = 2000;
+
+  SymbolLookupTask(Isolate* isolate,
+                   intptr_t id,
+                   intptr_t num_tasks,
+                   Monitor* done_monitor,
+                   bool* done)
+      : isolate_(isolate),
+        id_(id),
+        num_tasks_(num_tasks),
+        done_monitor_(done_monitor),
+        done_(done) {}
+
+  virtual void Run() {
+    Thread::EnterIsolateAsHelper(isolate_, Thread::kUnknownTask);
+    {
+      Thread* thread = Thread::Current();
+      StackZone stack_zone(thread);
+      Zone* zone = stack_zone.GetZone();
+      HANDLESCOPE(thread);
+      String& symbol = String::Handle(zone);
+      String& other = String::Handle(zone);
+      String& prefix = String::Handle(zone);
+      String& suffix = String::Handle(zone);
+      for (intptr_t i = 0; i < kSymbolCount; i++) {
+        // Adding symbols from every task grows the table while the other
+        // tasks look symbols up.
+        symbol = Symbols::NewFormatted(thread, "SymbolLookup_%" Pd "_%" Pd,
+                                       id_, i);
+        prefix = String::NewFormatted("SymbolLookup_%" Pd "_", id_);
+        suffix = String::NewFormatted("%" Pd, i);
+        EXPECT(Symbols::LookupFromConcat(thread, prefix, suffix) ==
+               symbol.raw());
+        // Another task may or may not have added this symbol yet, but a
+        // symbol that is found has to be complete.
+        const intptr_t other_id = (id_ + 1) % num_tasks_;
+        prefix = String::NewFormatted("SymbolLookup_%" Pd "_", other_id);
+        other = Symbols::LookupFromConcat(thread, prefix, suffix);
+        if (!other.IsNull()) {
+          EXPECT(other.IsSymbol());
+          EXPECT(other.Equals(String::Handle(
+              zone, String::Concat(prefix, suffix))));
+        }
+      }
+    }
+    Thread::ExitIsolateAsHelper();
+    // Tell main thread that we are ready.
+    {
+      MonitorLocker ml(done_monitor_);
+      ASSERT(!*done_);
+      *done_ = true;
+      ml.Notify();
+    }
+  }
+
+ private:
+  Isolate* isolate_;
+  intptr_t id_;
+  intptr_t num_tasks_;
+  Monitor* done_monitor_;
+  bool* done_;
+};
+
+ISOLATE_UNIT_TEST_CASE(ConcurrentSymbolLookup) {
+  const int NUMBER_TEST_THREADS = 8;
+  Monitor done_monitor[NUMBER_TEST_THREADS];
+  bool done[NUMBER_TEST_THREADS];
+  Isolate* isolate = thread->isolate();
+  for (int i = 0; i < NUMBER_TEST_THREADS; i++) {
+    done[i] = false;
+    Dart::thread_pool()->Run<SymbolLookupTask>(
+        isolate, i, NUMBER_TEST_THREADS, &done_monitor[i], &done[i]);
+  }
+
+  for (int i = 0; i < NUMBER_TEST_THREADS; i++) {
+    MonitorLocker ml(&done_monitor[i]);
+    while (!done[i]) {
+      ml.WaitWithSafepointCheck(thread);
+    }
+  }
+
+  // Every symbol is still in the table once all tasks are done.
+  String& symbol = String::Handle();
+  for (int i = 0; i < NUMBER_TEST_THREADS; i++) {
+    for (intptr_t j = 0; j < SymbolLookupTask::kSymbolCount;
+         j += SymbolLookupTask::kSymbolCount / 10) {
+      symbol = String::NewFormatted("SymbolLookup_%d_%" Pd, i, j);
+      EXPECT(Symbols::Lookup(thread, symbol) != String::null());
+    }
+  }
+}
+
 }  // namespace dart
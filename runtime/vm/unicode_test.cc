@@ -1090,4 +1090,42 @@ ISOLATE_UNIT_TEST_CASE(Utf8Decode) {
   }
 }
 
+ISOLATE_UNIT_TEST_CASE(Utf8AsciiRuns) {
+  // Long ASCII runs around non-ASCII characters, so both the word at a time
+  // scan and the byte tail are exercised.
+  const char* src =
+      "abcdefghijklmnopqrstuvwxyz\xC3\xB1"
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZ\xF0\x9F\x98\x80"
+      "0123456789";
+  const uint8_t* utf8 = reinterpret_cast<const uint8_t*>(src);
+  const intptr_t utf8_len = strlen(src);
+  EXPECT_EQ(26, Utf8::AsciiPrefixLength(utf8, utf8_len));
+  EXPECT_EQ(10, Utf8::AsciiPrefixLength(utf8 + 58, utf8_len - 58));
+  EXPECT_EQ(0, Utf8::AsciiPrefixLength(utf8 + 26, utf8_len - 26));
+  EXPECT(Utf8::IsValid(utf8, utf8_len));
+  EXPECT(!Utf8::IsValid(utf8, utf8_len - 11));  // Truncated code point.
+
+  Utf8::Type type;
+  const intptr_t len = Utf8::CodeUnitCount(utf8, utf8_len, &type);
+  EXPECT_EQ(Utf8::kSupplementary, type);
+  EXPECT_EQ(26 + 1 + 26 + 2 + 10, len);
+
+  uint16_t utf16[26 + 1 + 26 + 2 + 10];
+  EXPECT(Utf8::DecodeToUTF16(utf8, utf8_len, utf16, len));
+  EXPECT_EQ('z', utf16[25]);
+  EXPECT_EQ(0xF1, utf16[26]);
+  EXPECT_EQ('A', utf16[27]);
+  EXPECT_EQ(0xD83D, utf16[53]);
+  EXPECT_EQ(0xDE00, utf16[54]);
+  EXPECT_EQ('9', utf16[64]);
+  EXPECT(!Utf8::DecodeToUTF16(utf8, utf8_len, utf16, len - 1));
+
+  // Only the Latin-1 prefix.
+  uint8_t latin1[26 + 1 + 26];
+  EXPECT(Utf8::DecodeToLatin1(utf8, 54, latin1, ARRAY_SIZE(latin1)));
+  EXPECT_EQ(0xF1, latin1[26]);
+  EXPECT_EQ('Z', latin1[52]);
+  EXPECT(!Utf8::DecodeToLatin1(utf8, 54, latin1, 40));
+}
+
 }  // namespace dart
@@ -96,6 +96,13 @@ class _BigIntImpl implements BigInt {
   static const int _minInt = -0x8000000000000000;
   static const int _maxInt = 0x7fffffffffffffff;
 
+  // Above these sizes, in digits or decimal characters, multiplication,
+  // division and decimal conversion are done by subquadratic natives.
+  static const int _nativeMulThreshold = 48;
+  static const int _nativeDivThreshold = 64;
+  static const int _nativeToStringThreshold = 64;
+  static const int _nativeParseThreshold = 600;
+
   /// Certain methods of _BigIntImpl class are intrinsified by the VM
   /// depending on the runtime flags. They return number of processed
   /// digits (2) which is different from non-intrinsic implementation (1).
@@ -180,6 +187,10 @@ class _BigIntImpl implements BigInt {
   ///
   /// The [source] must not contain leading or trailing whitespace.
   static _BigIntImpl _parseDecimal(String source, bool isNegative) {
+    if (source.length >= _nativeParseThreshold) {
+      var digits = _parseDecimalNative(source);
+      return new _BigIntImpl._(isNegative, digits.length, digits);
+    }
     const _0 = 48;
 
     int part = 0;
@@ -1220,6 +1231,11 @@ class _BigIntImpl implements BigInt {
     var digits = _digits;
     var otherDigits = other._digits;
     var resultDigits = _newDigits(resultUsed);
+    if (used >= _nativeMulThreshold && otherUsed >= _nativeMulThreshold) {
+      _mulDigitsNative(digits, used, otherDigits, otherUsed, resultDigits);
+      return new _BigIntImpl._(
+          _isNegative != other._isNegative, resultUsed, resultDigits);
+    }
     var i = 0;
     while (i < otherUsed) {
       i += _mulAdd(otherDigits, i, digits, 0, resultDigits, i, used);
@@ -1236,6 +1252,13 @@ class _BigIntImpl implements BigInt {
     var resultUsed = xUsed + otherUsed;
     var i = resultUsed + (resultUsed & 1);
     assert(resultDigits.length >= i);
+    if (xUsed >= _nativeMulThreshold && otherUsed >= _nativeMulThreshold) {
+      if (resultUsed.isOdd) {
+        resultDigits[resultUsed] = 0;
+      }
+      return _mulDigitsNative(
+          xDigits, xUsed, otherDigits, otherUsed, resultDigits);
+    }
     while (--i >= 0) {
       resultDigits[i] = 0;
     }
@@ -1252,6 +1275,9 @@ class _BigIntImpl implements BigInt {
       Uint32List xDigits, int xUsed, Uint32List resultDigits) {
     var resultUsed = 2 * xUsed;
     assert(resultDigits.length >= resultUsed);
+    if (xUsed >= _nativeMulThreshold) {
+      return _mulDigitsNative(xDigits, xUsed, xDigits, xUsed, resultDigits);
+    }
     // Since resultUsed is even, no need for a leading zero for
     // 64-bit processing.
     var i = resultUsed;
@@ -1269,6 +1295,28 @@ class _BigIntImpl implements BigInt {
     return resultUsed;
   }
 
+  // resultDigits[0..xUsed+otherUsed-1] =
+  //     xDigits[0..xUsed-1]*otherDigits[0..otherUsed-1].
+  // Returns xUsed + otherUsed.
+  static int _mulDigitsNative(Uint32List xDigits, int xUsed,
+      Uint32List otherDigits, int otherUsed, Uint32List resultDigits)
+      native "Bigint_mulDigits";
+
+  // resultDigits[0..otherUsed-1] = xDigits % otherDigits and
+  // resultDigits[otherUsed..xUsed] = xDigits ~/ otherDigits, with
+  // xUsed >= otherUsed.
+  static void _divRemDigitsNative(Uint32List xDigits, int xUsed,
+      Uint32List otherDigits, int otherUsed, Uint32List resultDigits)
+      native "Bigint_divRemDigits";
+
+  // Returns the decimal representation of the positive digits[0..used-1].
+  static String _toDecimalStringNative(Uint32List digits, int used)
+      native "Bigint_toDecimalString";
+
+  // Returns the digits of the value of the decimal digits in source.
+  static Uint32List _parseDecimalNative(String source)
+      native "Bigint_parseDecimal";
+
   // Indices of the arguments of _estimateQuotientDigit.
   // For 64-bit processing by intrinsics on 64-bit platforms, the top digit pair
   // of the divisor is provided in the args array, and a 64-bit estimated
@@ -1368,6 +1416,23 @@ class _BigIntImpl implements BigInt {
     }
     assert(_used >= other._used);
 
+    if (other._used >= _nativeDivThreshold &&
+        _used - other._used >= _nativeDivThreshold) {
+      var resultUsed = _used + 1;
+      var resultDigits = _newDigits(resultUsed);
+      _divRemDigitsNative(
+          _digits, _used, other._digits, other._used, resultDigits);
+      _lastDividendDigits = _digits;
+      _lastDividendUsed = _used;
+      _lastDivisorDigits = other._digits;
+      _lastDivisorUsed = other._used;
+      _lastQuoRemDigits = resultDigits;
+      _lastQuoRemUsed = resultUsed;
+      _lastRemUsed = other._used;
+      _lastRem_nsh = 0;
+      return;
+    }
+
     var nsh = _digitBits - other._digits[other._used - 1].bitLength;
     // For 64-bit processing, make sure other has an even number of digits.
     if (other._used.isOdd) {
@@ -2437,6 +2502,10 @@ class _BigIntImpl implements BigInt {
       if (_isNegative) return (-_digits[0]).toString();
       return _digits[0].toString();
     }
+    if (_used >= _nativeToStringThreshold) {
+      var decimal = _toDecimalStringNative(_digits, _used);
+      return _isNegative ? "-$decimal" : decimal;
+    }
 
     // Generate in chunks of 9 digits.
     // The chunks are in reversed order.
@@ -549,6 +549,16 @@ abstract class _ChunkedJsonParser<T> {
    */
   int getChar(int index);
 
+  /**
+   * Skips ASCII string content that needs no further processing.
+   *
+   * Returns the position of the first character from [position] to [end]
+   * that is a quote, a backslash, a control character or not ASCII, or
+   * [end] if there is none. May return [position] if the parser has no
+   * faster way to scan than checking each character.
+   */
+  int skipPlainAsciiChars(int position, int end) => position;
+
   /**
    * Copy ASCII characters from start to end of chunk into a list.
    *
@@ -1014,7 +1024,14 @@ abstract class _ChunkedJsonParser<T> {
     int start = position;
     int end = chunkEnd;
     int bits = 0;
+    // Most strings are short keys. Only strings that are still going after
+    // the first few characters are handed to the faster scanner.
+    int skipPosition = start + 16;
     while (position < end) {
+      if (position == skipPosition) {
+        position = skipPlainAsciiChars(position, end);
+        if (position == end) break;
+      }
       int char = getChar(position++);
       bits |= char; // Includes final '"', but that never matters.
       // BACKSLASH is larger than QUOTE and SPACE.
@@ -1766,6 +1783,15 @@ class _JsonUtf8Parser extends _ChunkedJsonParser<List<int>> {
 
   int getChar(int position) => chunk[position];
 
+  int skipPlainAsciiChars(int position, int end) {
+    final chunk = this.chunk;
+    if (chunk is Uint8List) {
+      final int result = _skipPlainAsciiChars(chunk, position, end);
+      if (result >= 0) return result;
+    }
+    return position;
+  }
+
   String getString(int start, int end, int bits) {
     const int maxAsciiChar = 0x7f;
     if (bits <= maxAsciiChar) {
@@ -1810,6 +1836,9 @@ class _JsonUtf8Parser extends _ChunkedJsonParser<List<int>> {
 
 double _parseDouble(String source, int start, int end) native "Double_parse";
 
+int _skipPlainAsciiChars(Uint8List units, int from, int to)
+    native "JsonUtf8Parser_skipPlainAsciiChars";
+
 /**
  * Implements the chunked conversion from a UTF-8 encoding of JSON
  * to its corresponding object.
@@ -1854,6 +1883,12 @@ class _JsonUtf8DecoderSink extends ByteConversionSinkBase {
   }
 }
 
+// Below this length the native call costs more than the Dart loop.
+const int _nativeScanThreshold = 64;
+
+int _scanOneByteCharactersNative(Uint8List units, int from, int to)
+    native "Utf8Decoder_scanOneByteCharacters";
+
 @patch
 int _scanOneByteCharacters(List<int> units, int from, int endIndex) {
   final to = endIndex;
@@ -1861,6 +1896,11 @@ int _scanOneByteCharacters(List<int> units, int from, int endIndex) {
   // Special case for _Uint8ArrayView.
   if (units is Uint8List) {
     if (from >= 0 && to >= 0 && to <= units.length) {
+      // Long ranges are scanned a word at a time by the VM.
+      if (to - from >= _nativeScanThreshold) {
+        final int count = _scanOneByteCharactersNative(units, from, to);
+        if (count >= 0) return count;
+      }
       for (int i = from; i < to; i++) {
         final unit = units[i];
         if ((unit & _ONE_BYTE_LIMIT) != unit) return i - from;
@@ -11,7 +11,7 @@
 
 import "dart:core" hide Symbol;
 
-import "dart:typed_data" show Int32List;
+import "dart:typed_data" show Float64List, Int32List, TypedData;
 
 /// These are the additional parts of this patch library:
 // part "class_id_fasta.dart";
@@ -124,3 +124,58 @@ Int32List _growRegExpStack(Int32List stack) {
 //
 // Important: this is unsafe and must be used with care.
 T unsafeCast<T>(Object v) native "Internal_unsafeCast";
+
+// Formats all elements of [list] as by [double.toString], joined by
+// [separator], in a single native call.
+String formatDoubles(Float64List list, [String separator = ","])
+    native "Double_formatAll";
+
+// Parses each of [sources] as by [double.parse]. Plain literals in a built-in
+// list are converted in a single native call, anything else element by
+// element.
+Float64List parseDoubles(List<String> sources) {
+  final result = new Float64List(sources.length);
+  int i = 0;
+  while (i < sources.length) {
+    i = _parseDoubles(sources, i, result);
+    if (i < sources.length) {
+      result[i] = double.parse(sources[i]);
+      i++;
+    }
+  }
+  return result;
+}
+
+int _parseDoubles(List<String> sources, int start, Float64List result)
+    native "Double_parseAll";
+
+// Whether the typed lists [a] and [b] have the same length and == elements.
+// Lists of the same element type are compared in a single native call.
+bool typedDataEquals(TypedData a, TypedData b) {
+  final equal = _typedDataEquals(a, b);
+  if (equal != null) return equal;
+  final aList = a as List;
+  final bList = b as List;
+  if (aList.length != bList.length) return false;
+  for (int i = 0; i < aList.length; i++) {
+    if (aList[i] != bList[i]) return false;
+  }
+  return true;
+}
+
+bool _typedDataEquals(TypedData a, TypedData b) native "TypedData_equals";
+
+// Stores the elements of the typed list [source] into the typed list [target]
+// from [start] on, converted to the element type of [target]: integers wrap
+// or clamp, and integers are converted to doubles as by [int.toDouble].
+void convertTypedData(TypedData target, int start, TypedData source) {
+  final end = start + (source as List).length;
+  RangeError.checkValidRange(start, end, (target as List).length);
+  if (!_convertTypedData(target, start, end, source, 0)) {
+    throw new ArgumentError.value(
+        source, "source", "Cannot convert to ${target.runtimeType}");
+  }
+}
+
+bool _convertTypedData(TypedData target, int start, int end, TypedData source,
+    int skipCount) native "TypedData_convertRange";
@@ -11,6 +11,10 @@ const int _maxLatin1 = 0xff;
 const int _maxUtf16 = 0xffff;
 const int _maxUnicode = 0x10ffff;
 
+// Below this many candidate positions, searching in Dart is quicker than
+// calling the native search.
+const int _nativeSearchThreshold = 32;
+
 @patch
 class String {
   @patch
@@ -340,7 +344,9 @@ abstract class _StringBase implements String {
     if (pattern is String) {
       String other = pattern;
       int maxIndex = this.length - other.length;
-      // TODO: Use an efficient string search (e.g. BMH).
+      if (maxIndex - start >= _nativeSearchThreshold) {
+        return _indexOfNative(other, start);
+      }
       for (int index = start; index <= maxIndex; index++) {
         if (_substringMatches(index, other)) {
           return index;
@@ -356,6 +362,8 @@ abstract class _StringBase implements String {
     return -1;
   }
 
+  int _indexOfNative(String pattern, int start) native "StringBase_indexOf";
+
   int lastIndexOf(Pattern pattern, [int start = null]) {
     if (start == null) {
       start = this.length;
@@ -1021,6 +1029,9 @@ class _OneByteString extends _StringBase {
         if (patternCu0 > 0xFF) {
           return -1;
         }
+        if (len - start >= _nativeSearchThreshold) {
+          return _indexOfNative(patternAsString, start);
+        }
         for (int i = start; i < len; i++) {
           if (this.codeUnitAt(i) == patternCu0) {
             return i;
@@ -1044,6 +1055,9 @@ class _OneByteString extends _StringBase {
         if (patternCu0 > 0xFF) {
           return false;
         }
+        if (len - start >= _nativeSearchThreshold) {
+          return _indexOfNative(patternAsString, start) >= 0;
+        }
         for (int i = start; i < len; i++) {
           if (this.codeUnitAt(i) == patternCu0) {
             return true;
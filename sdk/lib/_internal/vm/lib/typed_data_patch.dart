@@ -111,12 +111,34 @@ abstract class _TypedListBase {
   // Element size of toCid and fromCid must match (test at caller).
   bool _setRange(int startInBytes, int lengthInBytes, _TypedListBase from,
       int startFromInBytes, int toCid, int fromCid) native "TypedData_setRange";
+
+  // Stores value in the elements start..end-1. Returns false without storing
+  // anything if value is not an int or double of the element type.
+  bool _fillRange(int start, int end, Object value)
+      native "TypedData_fillRange";
+
+  // Returns the index of the first element in start..end-1 that is == to
+  // element, or -1.
+  int _indexOf(Object element, int start, int end) native "TypedData_indexOf";
+
+  // Stores the elements of from, starting at skipCount, in the elements
+  // start..end-1, converted as by loading and storing each one. Works for
+  // different element sizes and overlapping views. Returns false without
+  // storing anything for conversions from doubles to integers or SIMD types.
+  bool _convertRange(int start, int end, _TypedListBase from, int skipCount)
+      native "TypedData_convertRange";
 }
 
+// Ranges at least this long are filled and searched by natives.
+const int _nativeBulkThreshold = 16;
+
 mixin _IntListMixin implements List<int> {
   int get elementSizeInBytes;
   int get offsetInBytes;
   _ByteBuffer get buffer;
+  bool _fillRange(int start, int end, Object value);
+  int _indexOf(Object element, int start, int end);
+  bool _convertRange(int start, int end, _TypedListBase from, int skipCount);
 
   Iterable<T> whereType<T>() => new WhereTypeIterable<T>(this);
 
@@ -326,6 +348,9 @@ mixin _IntListMixin implements List<int> {
     } else if (start < 0) {
       start = 0;
     }
+    if (this.length - start >= _nativeBulkThreshold) {
+      return _indexOf(element, start, this.length);
+    }
     for (int i = start; i < this.length; i++) {
       if (this[i] == element) return i;
     }
@@ -383,6 +408,10 @@ mixin _IntListMixin implements List<int> {
 
   void fillRange(int start, int end, [int fillValue]) {
     RangeError.checkValidRange(start, end, this.length);
+    if (end - start >= _nativeBulkThreshold &&
+        _fillRange(start, end, fillValue)) {
+      return;
+    }
     for (var i = start; i < end; ++i) {
       this[i] = fillValue;
     }
@@ -427,6 +456,8 @@ mixin _TypedIntListMixin<SpawnedType extends List<int>> on _IntListMixin
             ClassID.getID(from))) {
           return;
         }
+      } else if (this._convertRange(start, end, fromAsTypedList, skipCount)) {
+        return;
       } else if (fromAsTypedList.buffer == this.buffer) {
         // Different element sizes, but same buffer means that we need
         // an intermediate structure.
@@ -471,6 +502,9 @@ mixin _DoubleListMixin implements List<double> {
   int get elementSizeInBytes;
   int get offsetInBytes;
   _ByteBuffer get buffer;
+  bool _fillRange(int start, int end, Object value);
+  int _indexOf(Object element, int start, int end);
+  bool _convertRange(int start, int end, _TypedListBase from, int skipCount);
 
   Iterable<T> whereType<T>() => new WhereTypeIterable<T>(this);
 
@@ -682,6 +716,9 @@ mixin _DoubleListMixin implements List<double> {
     } else if (start < 0) {
       start = 0;
     }
+    if (this.length - start >= _nativeBulkThreshold) {
+      return _indexOf(element, start, this.length);
+    }
     for (int i = start; i < this.length; i++) {
       if (this[i] == element) return i;
     }
@@ -739,6 +776,10 @@ mixin _DoubleListMixin implements List<double> {
 
   void fillRange(int start, int end, [double fillValue]) {
     RangeError.checkValidRange(start, end, this.length);
+    if (end - start >= _nativeBulkThreshold &&
+        _fillRange(start, end, fillValue)) {
+      return;
+    }
     for (var i = start; i < end; ++i) {
       this[i] = fillValue;
     }
@@ -784,6 +825,8 @@ mixin _TypedDoubleListMixin<SpawnedType extends List<double>>
             ClassID.getID(from))) {
           return;
         }
+      } else if (this._convertRange(start, end, fromAsTypedList, skipCount)) {
+        return;
       } else if (fromAsTypedList.buffer == this.buffer) {
         // Different element sizes, but same buffer means that we need
         // an intermediate structure.
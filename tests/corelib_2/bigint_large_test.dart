@@ -0,0 +1,112 @@
+// Copyright (c) 2019, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Testing multiplication, division and decimal conversion of Bigints large
+// enough to use the subquadratic algorithms.
+// VMOptions=--intrinsify --enable-asserts
+// VMOptions=--no-intrinsify --enable-asserts
+
+import "package:expect/expect.dart";
+
+import 'dart:math' show Random;
+
+final random = new Random(1234);
+
+BigInt randomBigInt(int hexDigits) {
+  var buffer = new StringBuffer();
+  buffer.write((1 + random.nextInt(15)).toRadixString(16));
+  for (int i = 1; i < hexDigits; i++) {
+    buffer.write(random.nextInt(16).toRadixString(16));
+  }
+  return BigInt.parse(buffer.toString(), radix: 16);
+}
+
+testMultiply() {
+  for (var bits in [1000, 3000, 10000, 33333]) {
+    var a = (BigInt.one << bits) - BigInt.one;
+    var b = (BigInt.one << (bits ~/ 3)) - BigInt.one;
+    Expect.equals(
+        (BigInt.one << (bits + bits ~/ 3)) -
+            (BigInt.one << bits) -
+            (BigInt.one << (bits ~/ 3)) +
+            BigInt.one,
+        a * b);
+    var square = (BigInt.one << (2 * bits)) - (BigInt.one << (bits + 1));
+    Expect.equals(square + BigInt.one, a * a);
+  }
+  for (var hexDigits in [500, 1000, 5000]) {
+    var a = randomBigInt(hexDigits);
+    var b = randomBigInt(hexDigits ~/ 2 + 7);
+    var c = randomBigInt(hexDigits + 3);
+    Expect.equals(a * (b + c), a * b + a * c);
+    Expect.equals((a * b) * c, a * (b * c));
+    Expect.equals(-(a * b), (-a) * b);
+  }
+}
+
+testDivide() {
+  for (var hexDigits in [600, 2000, 8000]) {
+    var a = randomBigInt(hexDigits);
+    var b = randomBigInt(hexDigits ~/ 3);
+    var r = randomBigInt(hexDigits ~/ 4);
+    var product = a * b;
+    Expect.equals(a, product ~/ b);
+    Expect.equals(BigInt.zero, product % b);
+    Expect.equals(a, (product + r) ~/ b);
+    Expect.equals(r, (product + r) % b);
+    Expect.equals(r, (product + r).remainder(b));
+    Expect.equals(-a, (-product - r) ~/ b);
+    Expect.equals(-r, (-product - r).remainder(b));
+    // Divisors whose top digit needs no normalization.
+    var c = (BigInt.one << (hexDigits * 2)) - BigInt.one;
+    Expect.equals(a, (a * c + r) ~/ c);
+    Expect.equals(r, (a * c + r) % c);
+  }
+}
+
+testDecimal() {
+  for (var n in [700, 2000, 10000]) {
+    var power = BigInt.from(10).pow(n);
+    Expect.equals("1" + "0" * n, power.toString());
+    Expect.equals("-1" + "0" * n, (-power).toString());
+    Expect.equals(power - BigInt.one, BigInt.parse("9" * n));
+    Expect.equals(-power, BigInt.parse("-1" + "0" * n));
+    Expect.equals(power, BigInt.parse("0" * 50 + "1" + "0" * n));
+  }
+  for (var hexDigits in [100, 600, 3000, 20000]) {
+    var a = randomBigInt(hexDigits);
+    Expect.equals(a, BigInt.parse(a.toString()));
+    Expect.equals(-a, BigInt.parse((-a).toString()));
+    var decimal = a.toString();
+    Expect.equals(decimal, BigInt.parse(decimal).toString());
+  }
+}
+
+// Values with an odd number of 32-bit digits just past the length of one of
+// the powers of ten used to split them.
+testDecimalOddLength() {
+  for (var used in [479, 957, 3827]) {
+    for (var a in [
+      (BigInt.one << (32 * used)) - BigInt.one,
+      (BigInt.one << (32 * used - 1)) + randomBigInt(8 * used - 9),
+    ]) {
+      Expect.equals(used * 32, a.bitLength);
+      var decimal = a.toString();
+      Expect.equals(a, BigInt.parse(decimal));
+      var k = decimal.length ~/ 2;
+      var power = BigInt.from(10).pow(k);
+      Expect.equals(decimal.substring(0, decimal.length - k),
+          (a ~/ power).toString());
+      Expect.equals(decimal.substring(decimal.length - k),
+          (a % power).toString().padLeft(k, "0"));
+    }
+  }
+}
+
+main() {
+  testMultiply();
+  testDivide();
+  testDecimal();
+  testDecimalOddLength();
+}
@@ -0,0 +1,69 @@
+// Copyright (c) 2019, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// VMOptions=--enable-isolate-groups --isolate_spawn_pool_size=2
+
+// Spawns isolates through the pool of prespawned isolates: more isolates than
+// the pool holds, concurrently and one after another, from isolates that exit
+// before their children, and again after every child has exited. The VM has
+// to shut down the isolates left in the pool when main exits.
+
+import 'dart:async';
+import 'dart:isolate';
+
+import "package:async_helper/async_helper.dart";
+import "package:expect/expect.dart";
+
+void echo(List args) {
+  final SendPort replyPort = args[0];
+  replyPort.send(args[1]);
+}
+
+// Spawns a grandchild and exits before the grandchild replies.
+void spawnAndExit(List args) {
+  Isolate.spawn(echo, args);
+}
+
+// Spawns [entryPoint] with [value] and completes with the reply once the
+// spawned isolate has exited.
+Future<Object> spawnAndWait(void entryPoint(List args), Object value) async {
+  final reply = new ReceivePort();
+  final exit = new ReceivePort();
+  await Isolate.spawn(entryPoint, [reply.sendPort, value],
+      onExit: exit.sendPort);
+  final result = await reply.first;
+  await exit.first;
+  return result;
+}
+
+Future testSequential() async {
+  for (int i = 0; i < 10; i++) {
+    Expect.equals(i, await spawnAndWait(echo, i));
+  }
+}
+
+Future testConcurrent() async {
+  final results = await Future.wait(
+      new List.generate(10, (int i) => spawnAndWait(echo, 'concurrent $i')));
+  for (int i = 0; i < 10; i++) {
+    Expect.equals('concurrent $i', results[i]);
+  }
+}
+
+Future testParentExitsFirst() async {
+  for (int i = 0; i < 5; i++) {
+    Expect.equals('nested $i', await spawnAndWait(spawnAndExit, 'nested $i'));
+  }
+}
+
+main() async {
+  asyncStart();
+  await testSequential();
+  await testConcurrent();
+  await testParentExitsFirst();
+  // All children have exited by now, the pool has to keep handing out
+  // isolates.
+  await testSequential();
+  asyncEnd();
+}
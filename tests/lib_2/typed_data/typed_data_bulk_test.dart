@@ -0,0 +1,120 @@
+// Copyright (c) 2019, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Tests fillRange, indexOf and converting setRange on ranges long enough to
+// be handled in bulk.
+
+import 'dart:typed_data';
+import 'package:expect/expect.dart';
+
+const n = 100;
+
+void expectAll(List list, int start, int end, Object value) {
+  for (int i = 0; i < list.length; i++) {
+    Expect.equals((start <= i && i < end) ? value : 0, list[i], "index $i");
+  }
+}
+
+testFillRange() {
+  var int8 = new Int8List(n)..fillRange(10, 90, 0x1FF);
+  expectAll(int8, 10, 90, -1);
+  var uint8 = new Uint8List(n)..fillRange(0, n, -2);
+  expectAll(uint8, 0, n, 254);
+  var clamped = new Uint8ClampedList(n)..fillRange(1, 99, 300);
+  expectAll(clamped, 1, 99, 255);
+  clamped.fillRange(1, 99, -300);
+  expectAll(clamped, 0, 0, 0);
+  var int16 = new Int16List(n)..fillRange(3, 97, 0x18000);
+  expectAll(int16, 3, 97, -0x8000);
+  var uint16 = new Uint16List(n)..fillRange(0, 50, 0x12345);
+  expectAll(uint16, 0, 50, 0x2345);
+  var int32 = new Int32List(n)..fillRange(7, 77, 0xFFFFFFFF);
+  expectAll(int32, 7, 77, -1);
+  var uint32 = new Uint32List(n)..fillRange(20, 40, -1);
+  expectAll(uint32, 20, 40, 0xFFFFFFFF);
+  var float32 = new Float32List(n)..fillRange(0, n, 0.1);
+  expectAll(float32, 0, n, new Float32List.fromList([0.1])[0]);
+  var float64 = new Float64List(n)..fillRange(5, 95, 0.1);
+  expectAll(float64, 5, 95, 0.1);
+
+  // Views of a buffer only fill their own range.
+  var bytes = new Uint8List(4 * n);
+  var view = new Int32List.view(bytes.buffer, 8, n - 4);
+  view.fillRange(0, n - 4, 0x01020304);
+  Expect.equals(0, bytes[7]);
+  Expect.equals(4, bytes[8]);
+  Expect.equals(1, bytes[8 + 4 * (n - 4) - 1]);
+  Expect.equals(0, bytes[8 + 4 * (n - 4)]);
+
+  Expect.throws(() => new Uint8List(n).fillRange(0, n + 1, 1));
+}
+
+testIndexOf() {
+  var int8 = new Int8List(n);
+  int8[60] = -1;
+  Expect.equals(60, int8.indexOf(-1));
+  Expect.equals(-1, int8.indexOf(255));
+  Expect.equals(-1, int8.indexOf(-1, 61));
+  Expect.equals(0, int8.indexOf(0));
+  Expect.equals(61, int8.indexOf(0, 60));
+
+  var uint16 = new Uint16List(n);
+  uint16[70] = 0xFFFF;
+  Expect.equals(70, uint16.indexOf(0xFFFF));
+  Expect.equals(-1, uint16.indexOf(-1));
+
+  var int32 = new Int32List.view(new Int32List(n).buffer, 4, n - 1);
+  int32[n - 2] = -5;
+  Expect.equals(n - 2, int32.indexOf(-5));
+  Expect.equals(-1, int32.indexOf(0xFFFFFFFB));
+
+  var float64 = new Float64List(n)..fillRange(0, n, 1.0);
+  float64[40] = double.nan;
+  float64[50] = -0.0;
+  Expect.equals(-1, float64.indexOf(double.nan));
+  Expect.equals(50, float64.indexOf(0.0));
+
+  var float32 = new Float32List(n);
+  float32[30] = 0.1;
+  Expect.equals(-1, float32.indexOf(0.1));
+  Expect.equals(30, float32.indexOf(float32[30]));
+}
+
+testConvertingSetRange() {
+  var int8 = new Int8List(n);
+  for (int i = 0; i < n; i++) int8[i] = i * 3 - 150;
+  var int16 = new Int16List(n)..setRange(0, n, int8);
+  var int32 = new Int32List(n)..setRange(0, n, int16);
+  var uint8 = new Uint8List(n)..setRange(0, n, int32);
+  var clamped = new Uint8ClampedList(n)..setRange(0, n, int16);
+  for (int i = 0; i < n; i++) {
+    Expect.equals(int8[i], int16[i]);
+    Expect.equals(int8[i], int32[i]);
+    Expect.equals(int8[i] & 0xFF, uint8[i]);
+    Expect.equals(int8[i] < 0 ? 0 : int8[i], clamped[i]);
+  }
+
+  var float64 = new Float64List(n);
+  for (int i = 0; i < n; i++) float64[i] = i / 3;
+  var float32 = new Float32List(n)..setRange(0, n, float64);
+  var back = new Float64List(n)..setRange(0, n, float32);
+  for (int i = 0; i < n; i++) {
+    Expect.equals(new Float32List.fromList([i / 3])[0], float32[i]);
+    Expect.equals(float32[i], back[i]);
+  }
+
+  // Overlapping views with different element sizes.
+  var buffer = new Uint8List(2 * n).buffer;
+  var bytes = new Uint8List.view(buffer);
+  var shorts = new Uint16List.view(buffer);
+  for (int i = 0; i < n; i++) bytes[i] = i;
+  shorts.setRange(0, n, bytes);
+  for (int i = 0; i < n; i++) Expect.equals(i, shorts[i]);
+}
+
+main() {
+  testFillRange();
+  testIndexOf();
+  testConvertingSetRange();
+}